@@ -0,0 +1,441 @@
+/*----------------------------------------------------------------------------
+* Copyright (c) Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+* C++ AMP algorithms library.
+*
+* This file contains the benchmark harness: timing, statistics, the CSV 
+* and JSON reports and the comparison against a baseline report.
+*---------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <amp.h>
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <cmath>
+#include <functional>
+#include <ios>
+#include <istream>
+#include <iterator>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace amp_benchmark
+{
+    typedef std::chrono::steady_clock benchmark_clock;
+
+    //----------------------------------------------------------------------------
+    // benchmark_case
+    //----------------------------------------------------------------------------
+
+    // A benchmark for one algorithm and element type. setup() allocates and fills the data for a given 
+    // element count on the accelerator_view and returns the function to time. The function must leave no 
+    // work outstanding other than work queued on the view, which the harness waits for.
+    //
+    // bytes_per_element is the effective traffic per element: the bytes an ideal implementation reads and 
+    // writes once each. GB/s figures are computed from it, so they are comparable across algorithms but are 
+    // not a measure of the traffic an implementation actually generates.
+    struct benchmark_case
+    {
+        std::string name;
+        std::string type;
+        size_t bytes_per_element;
+        std::function<std::function<void()>(const concurrency::accelerator_view&, int)> setup;
+    };
+
+    struct benchmark_config
+    {
+        benchmark_config() : warmup_runs(2), repetitions(10), min_sample_ms(5.0) {}
+
+        int warmup_runs;
+        int repetitions;
+        // Runs too short for the clock to resolve are batched until a sample takes at least this long.
+        double min_sample_ms;
+        std::vector<int> sizes;
+        std::string filter;
+    };
+
+    struct benchmark_result
+    {
+        std::string name;
+        std::string type;
+        int size;
+        int repetitions;
+        double median_ms;
+        double p95_ms;
+        double min_ms;
+        double elements_per_second;
+        double gb_per_second;
+    };
+
+    //----------------------------------------------------------------------------
+    // statistics
+    //----------------------------------------------------------------------------
+
+    // Nearest rank percentile, p in [0, 100].
+    inline double percentile(std::vector<double> samples, const double p)
+    {
+        if (samples.empty())
+        {
+            return 0.0;
+        }
+        std::sort(samples.begin(), samples.end());
+        const double rank = std::ceil(p / 100.0 * samples.size());
+        const size_t idx = (rank < 1.0) ? 0 : std::min(static_cast<size_t>(rank) - 1, samples.size() - 1);
+        return samples[idx];
+    }
+
+    inline double median(std::vector<double> samples)
+    {
+        if (samples.empty())
+        {
+            return 0.0;
+        }
+        std::sort(samples.begin(), samples.end());
+        const size_t mid = samples.size() / 2;
+        return ((samples.size() % 2) == 0) ? (samples[mid - 1] + samples[mid]) / 2.0 : samples[mid];
+    }
+
+    inline benchmark_result summarize(const benchmark_case& bench, const int size, const std::vector<double>& samples_ms)
+    {
+        benchmark_result result;
+        result.name = bench.name;
+        result.type = bench.type;
+        result.size = size;
+        result.repetitions = static_cast<int>(samples_ms.size());
+        result.median_ms = median(samples_ms);
+        result.p95_ms = percentile(samples_ms, 95.0);
+        result.min_ms = samples_ms.empty() ? 0.0 : *std::min_element(samples_ms.begin(), samples_ms.end());
+        const double seconds = result.median_ms / 1000.0;
+        result.elements_per_second = (seconds > 0.0) ? size / seconds : 0.0;
+        result.gb_per_second = (seconds > 0.0) ? (static_cast<double>(size) * bench.bytes_per_element) / seconds / 1.0e9 : 0.0;
+        return result;
+    }
+
+    //----------------------------------------------------------------------------
+    // timing
+    //----------------------------------------------------------------------------
+
+    inline double elapsed_ms(const benchmark_clock::time_point start, const benchmark_clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    // Returns config.repetitions samples of the time for one call of func, in milliseconds. The warm-up runs 
+    // JIT the kernels and fill the scratch pools, and the last of them sizes the batch of calls in each 
+    // sample.
+    inline std::vector<double> time_runs(const concurrency::accelerator_view& view, const benchmark_config& config, const std::function<void()>& func)
+    {
+        double warmup_ms = 0.0;
+        for (int i = 0; i < std::max(1, config.warmup_runs); ++i)
+        {
+            const benchmark_clock::time_point start = benchmark_clock::now();
+            func();
+            view.wait();
+            warmup_ms = elapsed_ms(start, benchmark_clock::now());
+        }
+        const int batch = (warmup_ms >= config.min_sample_ms) ? 1 : 
+            static_cast<int>(std::min(1.0e6, std::ceil(config.min_sample_ms / std::max(warmup_ms, 1.0e-3))));
+
+        std::vector<double> samples;
+        samples.reserve(config.repetitions);
+        for (int i = 0; i < config.repetitions; ++i)
+        {
+            const benchmark_clock::time_point start = benchmark_clock::now();
+            for (int j = 0; j < batch; ++j)
+            {
+                func();
+            }
+            view.wait();
+            samples.push_back(elapsed_ms(start, benchmark_clock::now()) / batch);
+        }
+        return samples;
+    }
+
+    // Element counts from 2^min_log2 to 2^max_log2 in steps of a factor of 2^step_log2.
+    inline std::vector<int> size_range(const int min_log2, const int max_log2, const int step_log2)
+    {
+        std::vector<int> sizes;
+        for (int i = min_log2; i <= max_log2; i += std::max(1, step_log2))
+        {
+            sizes.push_back(1 << i);
+        }
+        return sizes;
+    }
+
+    //----------------------------------------------------------------------------
+    // run_benchmarks
+    //----------------------------------------------------------------------------
+
+    // True when "name/type" contains config.filter, or there is no filter.
+    inline bool matches_filter(const benchmark_config& config, const std::string& name, const std::string& type)
+    {
+        return config.filter.empty() || ((name + "/" + type).find(config.filter) != std::string::npos);
+    }
+
+    // Runs every case that matches config.filter at every size. A size that fails, for example because the 
+    // accelerator runs out of memory, is reported to errors and counted in error_count; it has no result.
+    inline std::vector<benchmark_result> run_benchmarks(const concurrency::accelerator_view& view, const std::vector<benchmark_case>& cases, 
+        const benchmark_config& config, std::ostream& errors, int& error_count)
+    {
+        std::vector<benchmark_result> results;
+        error_count = 0;
+        for (const auto& bench : cases)
+        {
+            if (!matches_filter(config, bench.name, bench.type))
+            {
+                continue;
+            }
+            for (const int size : config.sizes)
+            {
+                try
+                {
+                    const std::function<void()> func = bench.setup(view, size);
+                    results.push_back(summarize(bench, size, time_runs(view, config, func)));
+                }
+                catch (const std::exception& ex)
+                {
+                    errors << bench.name << "/" << bench.type << " at " << size << " elements failed: " << ex.what() << std::endl;
+                    ++error_count;
+                }
+            }
+        }
+        return results;
+    }
+
+    //----------------------------------------------------------------------------
+    // reports
+    //----------------------------------------------------------------------------
+
+    inline void write_csv(std::ostream& stream, const std::vector<benchmark_result>& results)
+    {
+        const std::ios_base::fmtflags flags = stream.flags();
+        stream << "name,type,size,repetitions,median_ms,p95_ms,min_ms,elements_per_second,gb_per_second\n";
+        stream << std::scientific;
+        for (const auto& r : results)
+        {
+            stream << r.name << "," << r.type << "," << r.size << "," << r.repetitions << "," << r.median_ms << "," << r.p95_ms << "," 
+                << r.min_ms << "," << r.elements_per_second << "," << r.gb_per_second << "\n";
+        }
+        stream.flags(flags);
+    }
+
+    inline void write_json(std::ostream& stream, const std::vector<benchmark_result>& results)
+    {
+        const std::ios_base::fmtflags flags = stream.flags();
+        stream << std::scientific;
+        stream << "{\"benchmarks\":[";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const benchmark_result& r = results[i];
+            stream << ((i == 0) ? "\n" : ",\n");
+            stream << "{\"name\":\"" << r.name << "\",\"type\":\"" << r.type << "\",\"size\":" << r.size << ",\"repetitions\":" << r.repetitions 
+                << ",\"median_ms\":" << r.median_ms << ",\"p95_ms\":" << r.p95_ms << ",\"min_ms\":" << r.min_ms 
+                << ",\"elements_per_second\":" << r.elements_per_second << ",\"gb_per_second\":" << r.gb_per_second << "}";
+        }
+        stream << "\n]}\n";
+        stream.flags(flags);
+    }
+
+    //----------------------------------------------------------------------------
+    // baselines
+    //----------------------------------------------------------------------------
+
+    namespace _details
+    {
+        // Parses the fields of one object written by write_json(), without the braces.
+        inline benchmark_result parse_result(const std::string& text)
+        {
+            std::map<std::string, std::string> fields;
+            std::istringstream stream(text);
+            std::string field;
+            while (std::getline(stream, field, ','))
+            {
+                const size_t colon = field.find(':');
+                if (colon == std::string::npos)
+                {
+                    throw std::runtime_error("Malformed benchmark field: " + field);
+                }
+                std::string key = field.substr(0, colon);
+                std::string value = field.substr(colon + 1);
+                key.erase(std::remove_if(key.begin(), key.end(), [](char c) { return (c == '"') || std::isspace(static_cast<unsigned char>(c)); }), key.end());
+                value.erase(std::remove_if(value.begin(), value.end(), [](char c) { return (c == '"') || std::isspace(static_cast<unsigned char>(c)); }), value.end());
+                fields[key] = value;
+            }
+
+            const char* required[] = { "name", "type", "size", "repetitions", "median_ms", "p95_ms", "min_ms", "elements_per_second", "gb_per_second" };
+            for (const char* key : required)
+            {
+                if (fields.find(key) == fields.end())
+                {
+                    throw std::runtime_error(std::string("Benchmark result is missing ") + key + ".");
+                }
+            }
+            benchmark_result result;
+            result.name = fields["name"];
+            result.type = fields["type"];
+            result.size = std::stoi(fields["size"]);
+            result.repetitions = std::stoi(fields["repetitions"]);
+            result.median_ms = std::stod(fields["median_ms"]);
+            result.p95_ms = std::stod(fields["p95_ms"]);
+            result.min_ms = std::stod(fields["min_ms"]);
+            result.elements_per_second = std::stod(fields["elements_per_second"]);
+            result.gb_per_second = std::stod(fields["gb_per_second"]);
+            return result;
+        }
+    }
+
+    // Reads a report written by write_json(). Only that format is understood; names and types must not 
+    // contain commas, braces or colons.
+    inline std::vector<benchmark_result> read_json(std::istream& stream)
+    {
+        const std::string text((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        size_t pos = text.find('[');
+        if ((text.find("\"benchmarks\"") == std::string::npos) || (pos == std::string::npos))
+        {
+            throw std::runtime_error("Not a benchmark report.");
+        }
+        std::vector<benchmark_result> results;
+        while ((pos = text.find('{', pos)) != std::string::npos)
+        {
+            const size_t end = text.find('}', pos);
+            if (end == std::string::npos)
+            {
+                throw std::runtime_error("Unterminated benchmark result.");
+            }
+            results.push_back(_details::parse_result(text.substr(pos + 1, end - pos - 1)));
+            pos = end + 1;
+        }
+        return results;
+    }
+
+    enum class comparison_status : int
+    {
+        ok = 0,
+        improved = 1,
+        regressed = 2,
+        added = 3,
+        missing = 4
+    };
+
+    struct benchmark_comparison
+    {
+        benchmark_result current;
+        benchmark_result baseline;
+        comparison_status status;
+        // current median / baseline median, 0 for benchmarks with no baseline or no current result.
+        double ratio;
+    };
+
+    namespace _details
+    {
+        inline bool same_benchmark(const benchmark_result& a, const benchmark_result& b)
+        {
+            return (a.name == b.name) && (a.type == b.type) && (a.size == b.size);
+        }
+    }
+
+    // Compares each current result with the baseline result of the same name, type and size. A result 
+    // regresses when its median exceeds the baseline median by more than threshold (a fraction) plus the 
+    // baseline's own spread, p95 - median, so that noisy measurements need a larger change to fail. 
+    // Improvements use the same margin in the other direction. Baseline entries with no current result are 
+    // reported as missing, after the current results; remove the entries a filtered run skips from the 
+    // baseline first.
+    inline std::vector<benchmark_comparison> compare_to_baseline(const std::vector<benchmark_result>& baseline, 
+        const std::vector<benchmark_result>& current, const double threshold)
+    {
+        std::vector<benchmark_comparison> comparisons;
+        for (const auto& result : current)
+        {
+            benchmark_comparison comparison;
+            comparison.current = result;
+            comparison.status = comparison_status::added;
+            comparison.ratio = 0.0;
+            const auto match = std::find_if(baseline.begin(), baseline.end(), [&](const benchmark_result& b) 
+            {
+                return _details::same_benchmark(b, result);
+            });
+            if (match != baseline.end())
+            {
+                comparison.baseline = *match;
+                comparison.ratio = (match->median_ms > 0.0) ? result.median_ms / match->median_ms : 0.0;
+                const double margin = match->median_ms * threshold + std::max(0.0, match->p95_ms - match->median_ms);
+                comparison.status = (result.median_ms > match->median_ms + margin) ? comparison_status::regressed : 
+                    (result.median_ms < match->median_ms - margin) ? comparison_status::improved : comparison_status::ok;
+            }
+            comparisons.push_back(comparison);
+        }
+        for (const auto& entry : baseline)
+        {
+            if (std::none_of(current.begin(), current.end(), [&](const benchmark_result& r) { return _details::same_benchmark(r, entry); }))
+            {
+                benchmark_comparison comparison;
+                comparison.current = entry;
+                comparison.current.repetitions = 0;
+                comparison.current.median_ms = comparison.current.p95_ms = comparison.current.min_ms = 0.0;
+                comparison.current.elements_per_second = comparison.current.gb_per_second = 0.0;
+                comparison.baseline = entry;
+                comparison.status = comparison_status::missing;
+                comparison.ratio = 0.0;
+                comparisons.push_back(comparison);
+            }
+        }
+        return comparisons;
+    }
+
+    inline bool has_regressions(const std::vector<benchmark_comparison>& comparisons)
+    {
+        return std::any_of(comparisons.begin(), comparisons.end(), [](const benchmark_comparison& c) { return c.status == comparison_status::regressed; });
+    }
+
+    // True when a result regressed or a baseline entry has no current result.
+    inline bool has_failures(const std::vector<benchmark_comparison>& comparisons)
+    {
+        return std::any_of(comparisons.begin(), comparisons.end(), [](const benchmark_comparison& c) 
+        { 
+            return (c.status == comparison_status::regressed) || (c.status == comparison_status::missing); 
+        });
+    }
+
+    inline void write_comparison(std::ostream& stream, const std::vector<benchmark_comparison>& comparisons)
+    {
+        static const char* status_names[] = { "ok", "improved", "REGRESSED", "new", "MISSING" };
+        const std::ios_base::fmtflags flags = stream.flags();
+        const std::streamsize precision = stream.precision();
+        stream << std::fixed;
+        stream.precision(4);
+        for (const auto& c : comparisons)
+        {
+            stream << c.current.name << "/" << c.current.type << " " << c.current.size << ": " << status_names[static_cast<int>(c.status)];
+            if (c.status == comparison_status::missing)
+            {
+                stream << " " << c.baseline.median_ms << " ms -> no result";
+            }
+            else if (c.status != comparison_status::added)
+            {
+                stream << " " << c.baseline.median_ms << " ms -> " << c.current.median_ms << " ms (x" << c.ratio << ")";
+            }
+            stream << "\n";
+        }
+        stream.flags(flags);
+        stream.precision(precision);
+    }
+}
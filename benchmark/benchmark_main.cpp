@@ -0,0 +1,369 @@
+/*----------------------------------------------------------------------------
+* Copyright (c) Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+* C++ AMP algorithms library.
+*
+* This file contains the benchmark executable. Run with --help for options.
+*---------------------------------------------------------------------------*/
+
+#define NOMINMAX
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <amp_algorithms.h>
+#include <amp_stl_algorithms.h>
+
+#include "benchmark.h"
+
+using namespace concurrency;
+using namespace amp_benchmark;
+
+namespace
+{
+    template <typename T>
+    std::shared_ptr<array<T>> make_random_array(const accelerator_view& view, const int size)
+    {
+        std::vector<T> data(size);
+        std::mt19937 engine(42);
+        std::uniform_int_distribution<int> dist(-10000, 10000);
+        std::generate(data.begin(), data.end(), [&]() { return static_cast<T>(dist(engine)); });
+        return std::make_shared<array<T>>(size, data.begin(), data.end(), view);
+    }
+
+    // Each case's data lives in arrays on the benchmarked view, captured by shared_ptr so that the returned 
+    // function keeps them alive.
+
+    template <typename T>
+    benchmark_case reduce_case(const std::string& type)
+    {
+        benchmark_case bench = { "reduce", type, sizeof(T), [](const accelerator_view& view, const int size) -> std::function<void()>
+        {
+            auto input = make_random_array<T>(view, size);
+            return [=]()
+            {
+                array_view<const T> input_av(*input);
+                amp_algorithms::reduce(view, input_av, amp_algorithms::plus<T>());
+            };
+        } };
+        return bench;
+    }
+
+    template <typename T>
+    benchmark_case scan_case(const std::string& type)
+    {
+        benchmark_case bench = { "scan_exclusive", type, 2 * sizeof(T), [](const accelerator_view& view, const int size) -> std::function<void()>
+        {
+            auto input = make_random_array<T>(view, size);
+            auto output = std::make_shared<array<T>>(size, view);
+            return [=]()
+            {
+                array_view<T> input_av(*input);
+                array_view<T> output_av(*output);
+                amp_algorithms::scan_exclusive(view, input_av, output_av);
+            };
+        } };
+        return bench;
+    }
+
+    template <typename T>
+    benchmark_case radix_sort_case(const std::string& type)
+    {
+        benchmark_case bench = { "radix_sort", type, 2 * sizeof(T), [](const accelerator_view& view, const int size) -> std::function<void()>
+        {
+            auto input = make_random_array<T>(view, size);
+            auto keys = std::make_shared<array<T>>(size, view);
+            auto output = std::make_shared<array<T>>(size, view);
+            return [=]()
+            {
+                // radix_sort() uses its input as scratch space, so each run sorts a fresh copy of the data. The 
+                // accelerator side copy is included in the time.
+                concurrency::copy(*input, *keys);
+                array_view<T> keys_av(*keys);
+                array_view<T> output_av(*output);
+                amp_algorithms::radix_sort(view, keys_av, output_av);
+            };
+        } };
+        return bench;
+    }
+
+    template <typename T>
+    benchmark_case transform_case(const std::string& type)
+    {
+        benchmark_case bench = { "transform", type, 2 * sizeof(T), [](const accelerator_view& view, const int size) -> std::function<void()>
+        {
+            auto input = make_random_array<T>(view, size);
+            auto output = std::make_shared<array<T>>(size, view);
+            return [=]()
+            {
+                array_view<const T> input_av(*input);
+                array_view<T> output_av(*output);
+                amp_algorithms::transform(view, input_av, output_av, [](const T& v) restrict(amp) { return v * v + T(1); });
+            };
+        } };
+        return bench;
+    }
+
+    template <typename T>
+    benchmark_case fill_case(const std::string& type)
+    {
+        benchmark_case bench = { "fill", type, sizeof(T), [](const accelerator_view& view, const int size) -> std::function<void()>
+        {
+            auto output = std::make_shared<array<T>>(size, view);
+            return [=]()
+            {
+                array_view<T> output_av(*output);
+                amp_algorithms::fill(view, output_av, T(1));
+            };
+        } };
+        return bench;
+    }
+
+    // The STL style algorithms run on the auto-selected view. Their data is allocated on the benchmarked 
+    // view, which the runtime then chooses.
+
+    template <typename T>
+    benchmark_case copy_if_case(const std::string& type)
+    {
+        benchmark_case bench = { "copy_if", type, 2 * sizeof(T), [](const accelerator_view& view, const int size) -> std::function<void()>
+        {
+            auto input = make_random_array<T>(view, size);
+            auto output = std::make_shared<array<T>>(size, view);
+            return [=]()
+            {
+                array_view<T> input_av(*input);
+                array_view<T> output_av(*output);
+                amp_stl_algorithms::copy_if(begin(input_av), end(input_av), begin(output_av), [](const T& v) restrict(amp) { return v > T(0); });
+            };
+        } };
+        return bench;
+    }
+
+    template <typename T>
+    benchmark_case count_if_case(const std::string& type)
+    {
+        benchmark_case bench = { "count_if", type, sizeof(T), [](const accelerator_view& view, const int size) -> std::function<void()>
+        {
+            auto input = make_random_array<T>(view, size);
+            return [=]()
+            {
+                array_view<T> input_av(*input);
+                amp_stl_algorithms::count_if(begin(input_av), end(input_av), [](const T& v) restrict(amp) { return v > T(0); });
+            };
+        } };
+        return bench;
+    }
+
+    template <typename T>
+    benchmark_case find_case(const std::string& type)
+    {
+        benchmark_case bench = { "find", type, sizeof(T), [](const accelerator_view& view, const int size) -> std::function<void()>
+        {
+            auto input = make_random_array<T>(view, size);
+            return [=]()
+            {
+                // The value is outside the generated range, so every element is examined.
+                array_view<T> input_av(*input);
+                amp_stl_algorithms::find(begin(input_av), end(input_av), T(20000));
+            };
+        } };
+        return bench;
+    }
+
+    std::vector<benchmark_case> all_cases()
+    {
+        std::vector<benchmark_case> cases;
+        cases.push_back(reduce_case<int>("int"));
+        cases.push_back(reduce_case<float>("float"));
+        cases.push_back(scan_case<int>("int"));
+        cases.push_back(scan_case<float>("float"));
+        cases.push_back(radix_sort_case<int>("int"));
+        cases.push_back(radix_sort_case<unsigned int>("unsigned"));
+        cases.push_back(radix_sort_case<float>("float"));
+        cases.push_back(copy_if_case<int>("int"));
+        cases.push_back(copy_if_case<float>("float"));
+        cases.push_back(transform_case<int>("int"));
+        cases.push_back(transform_case<float>("float"));
+        cases.push_back(fill_case<int>("int"));
+        cases.push_back(fill_case<float>("float"));
+        cases.push_back(count_if_case<int>("int"));
+        cases.push_back(count_if_case<float>("float"));
+        cases.push_back(find_case<int>("int"));
+        cases.push_back(find_case<float>("float"));
+        return cases;
+    }
+
+    void print_usage()
+    {
+        std::cout << "Usage: amp_algorithms_benchmark [options]\n"
+            "  --min-size <log2>      smallest element count as a power of two (default 10, 1K)\n"
+            "  --max-size <log2>      largest element count as a power of two (default 28, 256M)\n"
+            "  --step <log2>          size step as a power of two (default 2)\n"
+            "  --warmup <n>           untimed runs before each measurement (default 2)\n"
+            "  --repetitions <n>      timed samples per measurement (default 10)\n"
+            "  --filter <text>        only run benchmarks whose name/type contains text\n"
+            "  --format csv|json      report format (default csv)\n"
+            "  --output <file>        write the report to a file instead of stdout\n"
+            "  --baseline <file>      compare the medians with a JSON report from an earlier run and exit\n"
+            "                         with status 1 if any benchmark regressed or has no result\n"
+            "  --threshold <fraction> slowdown allowed beyond the baseline's p95 spread (default 0.1)\n"
+            "  --accelerator <name>   default, warp (the CPU based WARP device) or a device path\n"
+            "  --list                 list the benchmarks and exit\n"
+            "Exits with status 1 if any benchmark fails to run.\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark_config config;
+    int min_log2 = 10;
+    int max_log2 = 28;
+    int step_log2 = 2;
+    std::string format = "csv";
+    std::string output_path;
+    std::string baseline_path;
+    double threshold = 0.1;
+    std::wstring accelerator_path;
+    bool list_only = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool has_value = (i + 1 < argc);
+        if (arg == "--min-size" && has_value) { min_log2 = std::atoi(argv[++i]); }
+        else if (arg == "--max-size" && has_value) { max_log2 = std::atoi(argv[++i]); }
+        else if (arg == "--step" && has_value) { step_log2 = std::atoi(argv[++i]); }
+        else if (arg == "--warmup" && has_value) { config.warmup_runs = std::atoi(argv[++i]); }
+        else if (arg == "--repetitions" && has_value) { config.repetitions = std::atoi(argv[++i]); }
+        else if (arg == "--filter" && has_value) { config.filter = argv[++i]; }
+        else if (arg == "--format" && has_value) { format = argv[++i]; }
+        else if (arg == "--output" && has_value) { output_path = argv[++i]; }
+        else if (arg == "--baseline" && has_value) { baseline_path = argv[++i]; }
+        else if (arg == "--threshold" && has_value) { threshold = std::atof(argv[++i]); }
+        else if (arg == "--accelerator" && has_value) { const std::string name = argv[++i]; accelerator_path.assign(name.begin(), name.end()); }
+        else if (arg == "--list") { list_only = true; }
+        else
+        {
+            print_usage();
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+    if (((format != "csv") && (format != "json")) || (min_log2 < 0) || (max_log2 > 30) || (config.repetitions < 1) || (threshold < 0.0))
+    {
+        print_usage();
+        return 2;
+    }
+
+    const std::vector<benchmark_case> cases = all_cases();
+    if (list_only)
+    {
+        for (const auto& bench : cases)
+        {
+            std::cout << bench.name << "/" << bench.type << "\n";
+        }
+        return 0;
+    }
+
+    // Read the baseline first so that a bad path fails before the benchmarks run.
+    std::vector<benchmark_result> baseline;
+    if (!baseline_path.empty())
+    {
+        std::ifstream baseline_file(baseline_path);
+        if (!baseline_file)
+        {
+            std::cerr << "Cannot open " << baseline_path << std::endl;
+            return 2;
+        }
+        try
+        {
+            baseline = read_json(baseline_file);
+        }
+        catch (const std::exception& ex)
+        {
+            std::cerr << baseline_path << ": " << ex.what() << std::endl;
+            return 2;
+        }
+        // Entries the filter excludes are not run, so they are not expected to have a result.
+        baseline.erase(std::remove_if(baseline.begin(), baseline.end(), 
+            [&](const benchmark_result& b) { return !matches_filter(config, b.name, b.type); }), baseline.end());
+    }
+
+    config.sizes = size_range(min_log2, max_log2, step_log2);
+    accelerator_view view = accelerator().default_view;
+    try
+    {
+        if (accelerator_path == L"warp")
+        {
+            view = accelerator(accelerator::direct3d_warp).default_view;
+        }
+        else if (!accelerator_path.empty() && (accelerator_path != L"default"))
+        {
+            view = accelerator(accelerator_path).default_view;
+        }
+    }
+    catch (const runtime_exception& ex)
+    {
+        std::cerr << "Cannot use accelerator: " << ex.what() << std::endl;
+        return 2;
+    }
+    std::wcerr << L"Running on " << view.accelerator.description << std::endl;
+
+    int error_count = 0;
+    const std::vector<benchmark_result> results = run_benchmarks(view, cases, config, std::cerr, error_count);
+
+    std::ofstream file;
+    if (!output_path.empty())
+    {
+        file.open(output_path);
+        if (!file)
+        {
+            std::cerr << "Cannot open " << output_path << std::endl;
+            return 2;
+        }
+    }
+    std::ostream& report = output_path.empty() ? std::cout : file;
+    if (format == "json")
+    {
+        write_json(report, results);
+    }
+    else
+    {
+        write_csv(report, results);
+    }
+
+    if (!baseline_path.empty())
+    {
+        const std::vector<benchmark_comparison> comparisons = compare_to_baseline(baseline, results, threshold);
+        write_comparison(std::cerr, comparisons);
+        if (has_failures(comparisons))
+        {
+            std::cerr << "Performance regressions or missing results against " << baseline_path << "." << std::endl;
+            return 1;
+        }
+    }
+    if (error_count > 0)
+    {
+        std::cerr << error_count << " benchmark runs failed." << std::endl;
+        return 1;
+    }
+    return 0;
+}
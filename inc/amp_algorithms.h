@@ -26,6 +26,12 @@
 #pragma once
 
 #include <amp.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <type_traits>
+#include <vector>
 
 #include <xx_amp_algorithms_impl.h>
 #include <xx_amp_stl_algorithms_impl_inl.h>
@@ -392,6 +398,145 @@ namespace amp_algorithms
 
 #pragma endregion
 
+    //----------------------------------------------------------------------------
+    // host dispatch
+    //----------------------------------------------------------------------------
+    //
+    // Inputs with fewer elements than an algorithm's host dispatch threshold are processed by a plain loop on 
+    // the host rather than by a kernel, which avoids the launch, copy and synchronization latency that dominates 
+    // small calls. This only happens when the input is a rank 1 concurrency::array_view whose data source is in 
+    // host memory, so that data() does not copy it back from an accelerator, and any functor is known to be 
+    // callable on the host (see is_host_callable). A threshold of zero disables host dispatch for that algorithm.
+
+    enum class host_dispatch_algorithm : int
+    {
+        reduce = 0,         // amp_algorithms::reduce, amp_stl_algorithms::reduce
+        find = 1,           // amp_stl_algorithms::find
+        count = 2           // amp_stl_algorithms::count
+    };
+
+    // True for functors whose operator() is restrict(cpu, amp). The library's arithmetic, min, max, logical and 
+    // bitwise function objects are marked. Specialize it for user functors that are restrict(cpu, amp); lambdas 
+    // cannot be marked and always run on the accelerator.
+    template <typename Functor>
+    struct is_host_callable : std::false_type { };
+
+    template <typename T> struct is_host_callable<plus<T>> : std::true_type { };
+    template <typename T> struct is_host_callable<minus<T>> : std::true_type { };
+    template <typename T> struct is_host_callable<multiplies<T>> : std::true_type { };
+    template <typename T> struct is_host_callable<max<T>> : std::true_type { };
+    template <typename T> struct is_host_callable<min<T>> : std::true_type { };
+    template <typename T> struct is_host_callable<logical_and<T>> : std::true_type { };
+    template <typename T> struct is_host_callable<logical_or<T>> : std::true_type { };
+    template <typename T> struct is_host_callable<bit_and<T>> : std::true_type { };
+    template <typename T> struct is_host_callable<bit_or<T>> : std::true_type { };
+    template <typename T> struct is_host_callable<bit_xor<T>> : std::true_type { };
+
+    namespace _details
+    {
+        static const int host_dispatch_algorithm_count = 3;
+        static const int default_host_dispatch_threshold = 256;
+        static const int max_calibrated_host_dispatch_threshold = 64 * 1024;
+
+        // The thresholds can be read and set from any thread. Each entry holds the complement of its threshold, 
+        // which is negative, and zero means the default, so the table needs only the zero initialization that 
+        // static storage gets before any dynamic initialization runs. The members are static members of a class 
+        // template so that the header can define them.
+
+        template <typename Dummy = void>
+        struct host_dispatch_registry
+        {
+            static std::atomic<int> thresholds[host_dispatch_algorithm_count];
+        };
+
+        template <typename Dummy>
+        std::atomic<int> host_dispatch_registry<Dummy>::thresholds[host_dispatch_algorithm_count];
+
+        inline int host_dispatch_threshold(const host_dispatch_algorithm algorithm)
+        {
+            const int stored = host_dispatch_registry<>::thresholds[static_cast<int>(algorithm)].load(std::memory_order_relaxed);
+            return (stored == 0) ? default_host_dispatch_threshold : ~stored;
+        }
+
+        inline bool use_host_dispatch(const host_dispatch_algorithm algorithm, const int element_count)
+        {
+            return (element_count > 0) && (element_count < host_dispatch_threshold(algorithm));
+        }
+
+        template <typename IndexableView>
+        struct is_host_readable_view : std::false_type { };
+
+        template <typename T>
+        struct is_host_readable_view<concurrency::array_view<T, 1>> : std::true_type { };
+
+        // True when the view's data source is in host memory. data() may still copy elements that a kernel has 
+        // written since the view was last synchronized, which the runtime gives no way to detect.
+        template <typename T>
+        inline bool is_host_resident(const concurrency::array_view<T, 1>& view)
+        {
+            try
+            {
+                return view.get_source_accelerator_view().accelerator.device_path == concurrency::accelerator::cpu_accelerator;
+            }
+            catch (const concurrency::runtime_exception&)
+            {
+                // The view has no data source.
+                return false;
+            }
+        }
+    } // namespace _details
+
+    inline int get_host_dispatch_threshold(const host_dispatch_algorithm algorithm)
+    {
+        return _details::host_dispatch_threshold(algorithm);
+    }
+
+    inline void set_host_dispatch_threshold(const host_dispatch_algorithm algorithm, const int element_count)
+    {
+        if (element_count < 0)
+        {
+            throw concurrency::runtime_exception("The host dispatch threshold must not be negative.", E_INVALIDARG);
+        }
+        _details::host_dispatch_registry<>::thresholds[static_cast<int>(algorithm)].store(~element_count, std::memory_order_relaxed);
+    }
+
+    //----------------------------------------------------------------------------
+    // scratch memory
+    //----------------------------------------------------------------------------
+    //
+    // The algorithms draw their temporary arrays from a cache kept for each accelerator_view. Released 
+    // buffers are kept for reuse as long as the cache stays under its high-water mark, 64 MB by default. 
+    // The cache lives until release_scratch() is called for the view.
+
+    inline size_t get_scratch_high_water_mark(const concurrency::accelerator_view& accl_view)
+    {
+        return _details::get_scratch_pool(accl_view)->high_water_mark();
+    }
+
+    // Lowering the high-water mark frees cached buffers above it.
+    inline void set_scratch_high_water_mark(const concurrency::accelerator_view& accl_view, const size_t bytes)
+    {
+        _details::get_scratch_pool(accl_view)->set_high_water_mark(bytes);
+    }
+
+    inline size_t get_scratch_cached_bytes(const concurrency::accelerator_view& accl_view)
+    {
+        return _details::get_scratch_pool(accl_view)->cached_bytes();
+    }
+
+    // Frees cached buffers, largest first, until no more than max_cached_bytes remain.
+    inline void trim_scratch(const concurrency::accelerator_view& accl_view, const size_t max_cached_bytes = 0)
+    {
+        _details::get_scratch_pool(accl_view)->trim(max_cached_bytes);
+    }
+
+    // Frees the view's cache and its settings. Call this before discarding an accelerator_view made with 
+    // create_view(); otherwise the cache keeps the view alive.
+    inline void release_scratch(const concurrency::accelerator_view& accl_view)
+    {
+        _details::release_scratch_pool(accl_view);
+    }
+
 #pragma region Byte pack and unpack, padded read and write
 
     //----------------------------------------------------------------------------
@@ -403,7 +548,7 @@ namespace amp_algorithms
     {
         assert(value < 256);
         static_assert(index < sizeof(T), "Index out of range.");
-        return (static_cast<unsigned long>(value) && 0xFF) << (index * CHAR_BIT);
+        return (static_cast<unsigned long>(value) & 0xFF) << (index * CHAR_BIT);
     }
 
     template<typename T>
@@ -411,7 +556,7 @@ namespace amp_algorithms
     {
         //assert(value < 256);
         //assert(index < sizeof(T));
-        return (static_cast<unsigned long>(value) && 0xFF) << (index * CHAR_BIT);
+        return (static_cast<unsigned long>(value) & 0xFF) << (index * CHAR_BIT);
     }
 
     template<int index, typename T>
@@ -568,6 +713,182 @@ namespace amp_algorithms
         }
     };
 
+    //----------------------------------------------------------------------------
+    // packed_array_view
+    //----------------------------------------------------------------------------
+    //
+    // A rank 1 indexable view of unsigned char or unsigned short elements stored several to an unsigned int, 
+    // because kernels cannot address 8 or 16 bit types. Element i is held in bits (i % elements_per_word) * 
+    // element_bit_width and up of word i / elements_per_word, which is the layout of an array of T on a little 
+    // endian host, so a std::vector<T> can be viewed without a copy. Kernels cannot use T either, so value_type 
+    // is unsigned int and functors passed to algorithms take and return unsigned int.
+    //
+    // Each access through operator[] reads a whole word and writes on the accelerator are atomic, because 
+    // neighboring elements share a word. transform, reduce, transform_reduce, histogram and radix_sort have 
+    // overloads for packed views that process a whole word per thread instead, and count_if uses 
+    // transform_reduce.
+
+    namespace _details
+    {
+        template <typename T>
+        struct packed_element
+        {
+            static_assert(std::is_unsigned<T>::value && (sizeof(T) < sizeof(unsigned int)), "Packed elements must be unsigned char or unsigned short.");
+
+            static const int bit_width = sizeof(T) * CHAR_BIT;
+            static const int per_word = sizeof(unsigned int) / sizeof(T);
+            static const unsigned int mask = (1u << bit_width) - 1;
+
+            static unsigned int get(const unsigned int word, const int slot) restrict(cpu, amp)
+            {
+                return (word >> (slot * bit_width)) & mask;
+            }
+
+            static unsigned int put(const unsigned int value, const int slot) restrict(cpu, amp)
+            {
+                return (value & mask) << (slot * bit_width);
+            }
+
+            static int word_count(const int element_count) restrict(cpu, amp)
+            {
+                return (element_count + per_word - 1) / per_word;
+            }
+        };
+
+        // The element of a packed_array_view that operator[] returns. It converts to the element value and 
+        // assigning to it updates only that element's bits of the word.
+        template <typename T>
+        class packed_reference
+        {
+        public:
+            packed_reference(const concurrency::array_view<unsigned int>& words, const int idx) restrict(cpu, amp) : 
+                m_words(words), m_idx(idx)
+            {
+            }
+
+            operator unsigned int() const restrict(cpu, amp)
+            {
+                return packed_element<T>::get(m_words[word()], slot());
+            }
+
+            const packed_reference& operator=(const unsigned int value) const restrict(cpu)
+            {
+                unsigned int& word_value = m_words[word()];
+                word_value = (word_value & ~packed_element<T>::put(packed_element<T>::mask, slot())) | packed_element<T>::put(value, slot());
+                return *this;
+            }
+
+            // Replaces the element's bits with a compare and exchange loop so that a concurrent write to another 
+            // element of the same word is never lost and no thread observes the element cleared.
+            const packed_reference& operator=(const unsigned int value) const restrict(amp)
+            {
+                unsigned int* const word_ptr = &m_words[word()];
+                const unsigned int keep_mask = ~packed_element<T>::put(packed_element<T>::mask, slot());
+                const unsigned int bits = packed_element<T>::put(value, slot());
+                unsigned int expected = *word_ptr;
+                while (!concurrency::atomic_compare_exchange(word_ptr, &expected, (expected & keep_mask) | bits))
+                {
+                }
+                return *this;
+            }
+
+            const packed_reference& operator=(const packed_reference& other) const restrict(cpu, amp)
+            {
+                return *this = static_cast<unsigned int>(other);
+            }
+
+        private:
+            int word() const restrict(cpu, amp)
+            {
+                return m_idx / packed_element<T>::per_word;
+            }
+
+            int slot() const restrict(cpu, amp)
+            {
+                return m_idx % packed_element<T>::per_word;
+            }
+
+            concurrency::array_view<unsigned int> m_words;
+            int m_idx;
+        };
+    } // namespace _details
+
+    template <typename T>
+    class packed_array_view
+    {
+    public:
+        static const int rank = 1;
+        typedef unsigned int value_type;
+        static const int elements_per_word = _details::packed_element<T>::per_word;
+        static const int element_bit_width = _details::packed_element<T>::bit_width;
+
+        // A view of the first element_count elements packed in words.
+        packed_array_view(const concurrency::array_view<unsigned int>& words, const int element_count) : 
+            m_words(checked_words(words, element_count)), m_size(element_count)
+        {
+        }
+
+        // A view of the elements of data, whose size must be a non-zero multiple of elements_per_word.
+        explicit packed_array_view(std::vector<T>& data) : 
+            m_words(checked_word_count(data), reinterpret_cast<unsigned int*>(data.data())), m_size(static_cast<int>(data.size()))
+        {
+        }
+
+        _details::packed_reference<T> operator[](const concurrency::index<1>& idx) const restrict(cpu, amp)
+        {
+            return _details::packed_reference<T>(m_words, idx[0]);
+        }
+
+        __declspec(property(get=get_extent)) concurrency::extent<1> extent;
+        concurrency::extent<1> get_extent() const restrict(cpu, amp)
+        {
+            return concurrency::extent<1>(m_size);
+        }
+
+        // The words holding the elements. Bits of the last word past the end of the view may be overwritten.
+        concurrency::array_view<unsigned int> words() const restrict(cpu, amp)
+        {
+            return m_words;
+        }
+
+        int word_count() const restrict(cpu, amp)
+        {
+            return _details::packed_element<T>::word_count(m_size);
+        }
+
+        void synchronize() const
+        {
+            m_words.synchronize();
+        }
+
+        void discard_data() const
+        {
+            m_words.discard_data();
+        }
+
+    private:
+        static concurrency::array_view<unsigned int> checked_words(const concurrency::array_view<unsigned int>& words, const int element_count)
+        {
+            if ((element_count < 0) || (_details::packed_element<T>::word_count(element_count) > words.extent[0]))
+            {
+                throw concurrency::runtime_exception("The words cannot hold the number of elements.", E_INVALIDARG);
+            }
+            return (element_count == 0) ? words : words.section(0, _details::packed_element<T>::word_count(element_count));
+        }
+
+        static int checked_word_count(const std::vector<T>& data)
+        {
+            if (data.empty() || ((data.size() % elements_per_word) != 0))
+            {
+                throw concurrency::runtime_exception("The size of the data must be a non-zero multiple of the elements per word.", E_INVALIDARG);
+            }
+            return static_cast<int>(data.size()) / elements_per_word;
+        }
+
+        concurrency::array_view<unsigned int> m_words;
+        int m_size;
+    };
+
     //----------------------------------------------------------------------------
     // fill
     //----------------------------------------------------------------------------
@@ -575,6 +896,7 @@ namespace amp_algorithms
     template<typename OutputIndexableView, typename T>
     void fill(const concurrency::accelerator_view &accl_view, OutputIndexableView& output_view, const T& value)
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         ::amp_algorithms::generate(accl_view, output_view, [value]() restrict(amp) { return value; });
     }
 
@@ -591,7 +913,8 @@ namespace amp_algorithms
     template <typename OutputIndexableView, typename Generator>
     void generate(const concurrency::accelerator_view &accl_view, OutputIndexableView& output_view, const Generator& generator)
     {
-        _details::parallel_for_each(accl_view, output_view.extent, [output_view, generator](concurrency::index<indexable_view_traits<OutputIndexableView>::rank> idx) restrict(amp) {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        _details::for_each_index(accl_view, output_view.extent, [output_view, generator](concurrency::index<indexable_view_traits<OutputIndexableView>::rank> idx) restrict(amp) {
             output_view[idx] = generator();
         });
     }
@@ -625,6 +948,7 @@ namespace amp_algorithms
     template <typename T>
     inline void radix_sort(const concurrency::accelerator_view& accl_view, concurrency::array_view<T>& input_view, concurrency::array_view<T>& output_view)
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         static const int bin_width = 2;
         static const int tile_size = 128;
         _details::radix_sort<T, tile_size, bin_width>(accl_view, input_view, output_view);
@@ -653,13 +977,45 @@ namespace amp_algorithms
     // reduce
     //----------------------------------------------------------------------------
 
+    namespace _details
+    {
+        template <typename InputIndexableView, typename BinaryFunction>
+        typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type
+            dispatch_reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op, std::false_type)
+        {
+            const int tile_size = 512;
+            return _details::reduce<tile_size, 10000, InputIndexableView, BinaryFunction>(accl_view, input_view, binary_op);
+        }
+
+        template <typename InputIndexableView, typename BinaryFunction>
+        typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type
+            dispatch_reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op, std::true_type)
+        {
+            typedef typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type result_type;
+
+            const int element_count = input_view.extent.size();
+            if (!use_host_dispatch(host_dispatch_algorithm::reduce, element_count) || !is_host_resident(input_view))
+            {
+                return dispatch_reduce(accl_view, input_view, binary_op, std::false_type());
+            }
+            const auto data = input_view.data();
+            result_type result = data[0];
+            for (int i = 1; i < element_count; ++i)
+            {
+                result = binary_op(result, data[i]);
+            }
+            return result;
+        }
+    } // namespace _details
+
     // Generic reduction template for binary operators that are commutative and associative
     template <typename InputIndexableView, typename BinaryFunction>
     typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type
         reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op)
     {
-        const int tile_size = 512;
-        return _details::reduce<tile_size, 10000, InputIndexableView, BinaryFunction>(accl_view, input_view, binary_op);
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        return _details::dispatch_reduce(accl_view, input_view, binary_op, 
+            std::integral_constant<bool, _details::is_host_readable_view<InputIndexableView>::value && is_host_callable<BinaryFunction>::value>());
     }
 
     template <typename InputIndexableView, typename BinaryFunction>
@@ -669,90 +1025,1019 @@ namespace amp_algorithms
         return reduce(_details::auto_select_target(), input_view, binary_op);
     }
 
-    //----------------------------------------------------------------------------
-    // scan
-    //----------------------------------------------------------------------------
+    // Sets every host dispatch threshold to the input size at which the host loop takes as long as a small 
+    // reduction on accl_view, including copying its input and reading back its result. The host loop is timed 
+    // through array_view::data(), as the host dispatch paths read it. Thresholds are capped at 
+    // max_calibrated_host_dispatch_threshold elements, beyond which the accelerator's bandwidth wins regardless 
+    // of latency. Takes a few milliseconds.
+    inline void calibrate_host_dispatch(const concurrency::accelerator_view &accl_view)
+    {
+        typedef std::chrono::high_resolution_clock clock;
+        const int sample_size = 4096;
+        const int repeat_count = 8;
+        std::vector<int> sample(sample_size, 1);
+
+        // Best of several round trips, after a first one that compiles the shader.
+        double latency = 0.0;
+        for (int r = 0; r <= repeat_count; ++r)
+        {
+            const concurrency::array_view<const int> sample_vw(sample_size, sample);
+            const auto start = clock::now();
+            _details::dispatch_reduce(accl_view, sample_vw, amp_algorithms::plus<int>(), std::false_type());
+            const std::chrono::duration<double> elapsed = clock::now() - start;
+            latency = ((r == 1) || (elapsed.count() < latency)) ? elapsed.count() : latency;
+        }
 
-    // This header needs these enums but they also have to be defined in the _impl header for use by the 
-    // main STL header, which includes the _impl.
-#if !defined(AMP_ALGORITHMS_ENUMS)
-#define AMP_ALGORITHMS_ENUMS
-    enum class scan_mode : int
-    {
-        exclusive = 0,
-        inclusive = 1
-    };
+        // Host cost per element of each algorithm's loop. find and count are given no match and a full match 
+        // respectively so that they visit every element.
+        double host_seconds[_details::host_dispatch_algorithm_count] = {};
+        for (int r = 0; r < repeat_count; ++r)
+        {
+            const concurrency::array_view<const int> sample_vw(sample_size, sample);
+
+            auto start = clock::now();
+            const int* data = sample_vw.data();
+            volatile int sink = std::accumulate(data, data + sample_size, 0);
+            std::chrono::duration<double> elapsed = clock::now() - start;
+            host_seconds[static_cast<int>(host_dispatch_algorithm::reduce)] += elapsed.count();
+
+            start = clock::now();
+            data = sample_vw.data();
+            sink = static_cast<int>(std::distance(data, std::find(data, data + sample_size, 0)));
+            elapsed = clock::now() - start;
+            host_seconds[static_cast<int>(host_dispatch_algorithm::find)] += elapsed.count();
+
+            start = clock::now();
+            data = sample_vw.data();
+            sink = static_cast<int>(std::count(data, data + sample_size, 1));
+            elapsed = clock::now() - start;
+            host_seconds[static_cast<int>(host_dispatch_algorithm::count)] += elapsed.count();
+            (void)sink;
+        }
 
-    enum class scan_direction : int
+        for (int a = 0; a < _details::host_dispatch_algorithm_count; ++a)
+        {
+            const double per_element = (host_seconds[a] / (repeat_count * sample_size) > 1e-12) ? (host_seconds[a] / (repeat_count * sample_size)) : 1e-12;
+            const double threshold = latency / per_element;
+            set_host_dispatch_threshold(static_cast<host_dispatch_algorithm>(a), (threshold < _details::max_calibrated_host_dispatch_threshold) ? 
+                static_cast<int>(threshold) : _details::max_calibrated_host_dispatch_threshold);
+        }
+    }
+
+    inline void calibrate_host_dispatch()
     {
-        forward = 0,
-        backward = 1
-    };
-#endif
+        calibrate_host_dispatch(_details::auto_select_target());
+    }
 
-    template <int TileSize, scan_mode _Mode, typename _BinaryFunc, typename InputIndexableView>
-    inline void scan(const InputIndexableView& input_view, InputIndexableView& output_view, const _BinaryFunc& op)
+    // Reduces a rank 2 or rank 3 view along axis, writing one result for each position in the remaining axes. 
+    // For example reducing an extent<2>(rows, cols) view along axis 1 gives the sum of each row in an output 
+    // view of extent<1>(rows).
+    template <typename InputIndexableView, typename BinaryFunction, typename OutputIndexableView>
+    void reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const int axis, const BinaryFunction &binary_op, OutputIndexableView &output_view)
     {
-        _details::scan<TileSize, _Mode, _BinaryFunc>(_details::auto_select_target(), input_view, output_view, op);
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        const int tile_size = 256;
+        _details::reduce<tile_size, 10000>(accl_view, input_view, axis, binary_op, output_view);
     }
 
-    template <typename IndexableView>
-    void scan_exclusive(const concurrency::accelerator_view& accl_view, const IndexableView& input_view, IndexableView& output_view)
+    template <typename InputIndexableView, typename BinaryFunction, typename OutputIndexableView>
+    void reduce(const InputIndexableView &input_view, const int axis, const BinaryFunction &binary_op, OutputIndexableView &output_view)
     {
-        _details::scan<_details::scan_default_tile_size, amp_algorithms::scan_mode::exclusive>(accl_view, input_view, output_view, amp_algorithms::plus<IndexableView::value_type>());
+        reduce(_details::auto_select_target(), input_view, axis, binary_op, output_view);
     }
 
-    template <typename IndexableView>
-    void scan_exclusive(const IndexableView& input_view, IndexableView& output_view)
+    //----------------------------------------------------------------------------
+    // reproducible_reduce
+    //----------------------------------------------------------------------------
+
+    // Like reduce() but combines the elements in an order that depends only on the number of elements. Floating 
+    // point results are bitwise identical across runs and accelerators, at the cost of an extra launch per 
+    // 1024 fold in size. The input view must not be empty.
+    template <typename InputIndexableView, typename BinaryFunction>
+    typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type
+        reproducible_reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op)
     {
-        _details::scan<_details::scan_default_tile_size, amp_algorithms::scan_mode::exclusive>(_details::auto_select_target(), input_view, output_view, amp_algorithms::plus<typename IndexableView::value_type>());
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        // These fix the shape of the reduction tree and must not depend on the accelerator.
+        const int tile_size = 256;
+        const int items_per_thread = 4;
+        return _details::reproducible_reduce<tile_size, items_per_thread>(accl_view, input_view, binary_op);
     }
 
-    template <typename IndexableView>
-    void scan_inclusive(const concurrency::accelerator_view& accl_view, const IndexableView& input_view, IndexableView& output_view)
+    template <typename InputIndexableView, typename BinaryFunction>
+    typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type
+        reproducible_reduce(const InputIndexableView &input_view, const BinaryFunction &binary_op)
     {
-        _details::scan<_details::scan_default_tile_size, amp_algorithms::scan_mode::inclusive>(accl_view, input_view, output_view, amp_algorithms::plus<IndexableView::value_type>());
+        return reproducible_reduce(_details::auto_select_target(), input_view, binary_op);
     }
 
-    template <typename IndexableView>
-    void scan_inclusive(const IndexableView& input_view, IndexableView& output_view)
+    //----------------------------------------------------------------------------
+    // segmented_reduce
+    //----------------------------------------------------------------------------
+
+    // Reduces each segment [offsets_view[i], offsets_view[i + 1]) of input_view into output_view[i]. Segments are 
+    // binned by length so that short segments are reduced by single threads and long ones by whole tiles, 
+    // however their lengths are distributed. offsets_view holds one more element than the number of segments, as 
+    // in a CSR row offsets array. The output of an empty segment is left unchanged. binary_op must be commutative 
+    // and associative.
+    template <typename InputIndexableView, typename OffsetsIndexableView, typename BinaryFunction, typename OutputIndexableView>
+    void segmented_reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const OffsetsIndexableView &offsets_view, 
+        const BinaryFunction &binary_op, OutputIndexableView &output_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        static_assert(indexable_view_traits<InputIndexableView>::rank == 1, "The input indexable view must be of rank 1");
+        const int tile_size = 256;
+        const int segment_count = offsets_view.extent[0] - 1;
+        if (segment_count <= 0)
+        {
+            return;
+        }
+        _details::segmented_reduce<tile_size, 10000>(accl_view, input_view, offsets_view, binary_op, output_view);
+    }
+
+    template <typename InputIndexableView, typename OffsetsIndexableView, typename BinaryFunction, typename OutputIndexableView>
+    void segmented_reduce(const InputIndexableView &input_view, const OffsetsIndexableView &offsets_view, const BinaryFunction &binary_op, OutputIndexableView &output_view)
     {
-        _details::scan<_details::scan_default_tile_size, amp_algorithms::scan_mode::inclusive>(_details::auto_select_target(), input_view, output_view, amp_algorithms::plus<typename IndexableView::value_type>());
+        segmented_reduce(_details::auto_select_target(), input_view, offsets_view, binary_op, output_view);
     }
 
     //----------------------------------------------------------------------------
-    // transform (unary)
+    // transform_reduce
     //----------------------------------------------------------------------------
 
-    template <typename ConstInputIndexableView, typename OutputIndexableView, typename UnaryFunc>
-    void transform(const concurrency::accelerator_view &accl_view, const ConstInputIndexableView& input_view, OutputIndexableView& output_view, const UnaryFunc& func)
+    // Applies transform_op to each element as it is loaded and reduces the results with binary_op, without 
+    // writing the transformed values to an intermediate array. binary_op must be commutative and associative.
+    template <typename InputIndexableView, typename UnaryFunction, typename BinaryFunction>
+    typename std::result_of<UnaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&)>::type
+        transform_reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const UnaryFunction &transform_op, const BinaryFunction &binary_op)
     {
-        _details::parallel_for_each(accl_view, output_view.extent, [input_view,output_view,func] (concurrency::index<indexable_view_traits<OutputIndexableView>::rank> idx) restrict(amp) {
-            output_view[idx] = func(input_view[idx]);
-        });
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        static_assert(indexable_view_traits<InputIndexableView>::rank == 1, "The input indexable view must be of rank 1");
+        typedef typename std::result_of<UnaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&)>::type result_type;
+        const int tile_size = 512;
+        return _details::transform_reduce<tile_size, 10000, result_type>(accl_view, input_view.extent.size(), 
+            [=](const int idx) restrict(amp) { return transform_op(input_view[concurrency::index<1>(idx)]); }, binary_op);
     }
 
-    template <typename ConstInputIndexableView, typename OutputIndexableView, typename UnaryFunc>
-    void transform(const ConstInputIndexableView& input_view, OutputIndexableView& output_view, const UnaryFunc& func)
+    template <typename InputIndexableView, typename UnaryFunction, typename BinaryFunction>
+    typename std::result_of<UnaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&)>::type
+        transform_reduce(const InputIndexableView &input_view, const UnaryFunction &transform_op, const BinaryFunction &binary_op)
     {
-        ::amp_algorithms::transform(_details::auto_select_target(), input_view, output_view, func);
+        return transform_reduce(_details::auto_select_target(), input_view, transform_op, binary_op);
     }
 
     //----------------------------------------------------------------------------
-    // transform (binary)
+    // describe
     //----------------------------------------------------------------------------
 
-    template <typename ConstInputIndexableView1, typename ConstInputIndexableView2, typename OutputIndexableView, typename BinaryFunc>
-    void transform(const concurrency::accelerator_view &accl_view, const ConstInputIndexableView1& input_view1, const ConstInputIndexableView2& input_view2, OutputIndexableView& output_view, const BinaryFunc& func)
+    // Summary statistics of a view that describe() gathers in a single read of the data. The sums are accumulated 
+    // in T, so integer types may overflow for large or wide ranging inputs. The mean and the sum of squared 
+    // deviations from it are carried separately in moment_type, float for integer T, and partial results are 
+    // merged with Chan et al.'s parallel update. Computing the variance from sum_of_squares and sum instead 
+    // cancels catastrophically when the mean is large compared to the spread.
+
+    template <typename T>
+    struct descriptive_statistics
     {
-        _details::parallel_for_each(accl_view, output_view.extent, [input_view1,input_view2,output_view,func] (concurrency::index<indexable_view_traits<OutputIndexableView>::rank> idx) restrict(amp) {
-            output_view[idx] = func(input_view1[idx], input_view2[idx]);
-        });
+        typedef typename std::conditional<std::is_floating_point<T>::value, T, float>::type moment_type;
+
+        int count;
+        T sum;
+        T sum_of_squares;
+        T minimum;
+        T maximum;
+        moment_type running_mean;
+        moment_type squared_deviations;
+
+        moment_type mean() const restrict(cpu, amp)
+        {
+            return running_mean;
+        }
+
+        // Population variance.
+        moment_type variance() const restrict(cpu, amp)
+        {
+            return squared_deviations / static_cast<moment_type>(count);
+        }
+    };
+
+    namespace _details
+    {
+        template <typename T>
+        struct describe_load
+        {
+            descriptive_statistics<T> operator()(const T& value) const restrict(cpu, amp)
+            {
+                descriptive_statistics<T> s;
+                s.count = 1;
+                s.sum = value;
+                s.sum_of_squares = value * value;
+                s.minimum = value;
+                s.maximum = value;
+                s.running_mean = static_cast<typename descriptive_statistics<T>::moment_type>(value);
+                s.squared_deviations = 0;
+                return s;
+            }
+        };
+
+        template <typename T>
+        struct describe_combine
+        {
+            descriptive_statistics<T> operator()(const descriptive_statistics<T>& a, const descriptive_statistics<T>& b) const restrict(cpu, amp)
+            {
+                typedef typename descriptive_statistics<T>::moment_type moment_type;
+
+                descriptive_statistics<T> s;
+                s.count = a.count + b.count;
+                s.sum = a.sum + b.sum;
+                s.sum_of_squares = a.sum_of_squares + b.sum_of_squares;
+                s.minimum = (b.minimum < a.minimum) ? b.minimum : a.minimum;
+                s.maximum = (a.maximum < b.maximum) ? b.maximum : a.maximum;
+
+                const moment_type delta = b.running_mean - a.running_mean;
+                const moment_type b_weight = static_cast<moment_type>(b.count) / static_cast<moment_type>(s.count);
+                s.running_mean = a.running_mean + (delta * b_weight);
+                s.squared_deviations = a.squared_deviations + b.squared_deviations + (delta * delta * static_cast<moment_type>(a.count) * b_weight);
+                return s;
+            }
+        };
+    } // namespace _details
+
+    // Returns the count, sum, sum of squares, minimum, maximum, mean and variance of a rank 1 view. An empty view 
+    // returns a zero count and value initialized statistics.
+    template <typename InputIndexableView>
+    descriptive_statistics<typename std::remove_const<typename indexable_view_traits<InputIndexableView>::value_type>::type>
+        describe(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::remove_const<typename indexable_view_traits<InputIndexableView>::value_type>::type T;
+
+        if (input_view.extent.size() == 0)
+        {
+            descriptive_statistics<T> s = {};
+            return s;
+        }
+        return transform_reduce(accl_view, input_view, _details::describe_load<T>(), _details::describe_combine<T>());
     }
 
-    template <typename ConstInputIndexableView1, typename ConstInputIndexableView2, typename OutputIndexableView, typename BinaryFunc>
-    void transform(const ConstInputIndexableView1& input_view1, const ConstInputIndexableView2& input_view2, OutputIndexableView& output_view, const BinaryFunc& func)
+    template <typename InputIndexableView>
+    descriptive_statistics<typename std::remove_const<typename indexable_view_traits<InputIndexableView>::value_type>::type>
+        describe(const InputIndexableView &input_view)
     {
-        ::amp_algorithms::transform(_details::auto_select_target(), input_view1, input_view2, output_view, func);
+        return describe(_details::auto_select_target(), input_view);
+    }
+
+    //----------------------------------------------------------------------------
+    // accumulate, neumaier_sum
+    //----------------------------------------------------------------------------
+
+    // Accumulator for compensated (Neumaier) summation. Use it as the Accumulator type of accumulate(), 
+    // scan_exclusive() and scan_inclusive() to keep the error of a long floating point sum close to that of a 
+    // single addition, at roughly twice the arithmetic and storage. The compensation only survives if the 
+    // compiler does not reassociate floating point arithmetic, so build with /fp:precise or /fp:strict.
+    template <typename T>
+    struct neumaier_sum
+    {
+        T sum;
+        T compensation;
+
+        neumaier_sum() = default;
+
+        neumaier_sum(const T& value) restrict(cpu, amp) : sum(value), compensation(0) { }
+
+        T value() const restrict(cpu, amp)
+        {
+            return sum + compensation;
+        }
+
+        neumaier_sum& operator+=(const neumaier_sum& other) restrict(cpu, amp)
+        {
+            const T s = sum + other.sum;
+            const T abs_sum = (sum < 0) ? -sum : sum;
+            const T abs_other = (other.sum < 0) ? -other.sum : other.sum;
+
+            // Recover the low order bits of the smaller operand that were rounded away in s.
+            const T error = (abs_sum >= abs_other) ? ((sum - s) + other.sum) : ((other.sum - s) + sum);
+            compensation += other.compensation + error;
+            sum = s;
+            return *this;
+        }
+    };
+
+    template <typename T>
+    inline neumaier_sum<T> operator+(neumaier_sum<T> a, const neumaier_sum<T>& b) restrict(cpu, amp)
+    {
+        a += b;
+        return a;
+    }
+
+    namespace _details
+    {
+        // Converts an accumulator back to the element type. Accumulators other than neumaier_sum must be 
+        // convertible to T, for example double when accumulating float.
+        template <typename T, typename Accumulator>
+        inline T accumulator_value(const Accumulator& a) restrict(cpu, amp)
+        {
+            return static_cast<T>(a);
+        }
+
+        template <typename T, typename U>
+        inline T accumulator_value(const neumaier_sum<U>& a) restrict(cpu, amp)
+        {
+            return static_cast<T>(a.value());
+        }
+    } // namespace _details
+
+    // Reduces a rank 1 view after converting each element to Accumulator, which must be constructible from the 
+    // element type. Use neumaier_sum<float> for compensated float sums or, on accelerators where 
+    // accelerator::supports_limited_double_precision is true, double. reduce() cannot take the accumulator as 
+    // an explicit template argument without breaking overload resolution for its existing callers, hence the 
+    // separate name.
+    template <typename Accumulator, typename InputIndexableView, typename BinaryFunction>
+    Accumulator accumulate(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        static_assert(indexable_view_traits<InputIndexableView>::rank == 1, "The input indexable view must be of rank 1");
+        const int tile_size = 512;
+        return _details::transform_reduce<tile_size, 10000, Accumulator>(accl_view, input_view.extent.size(), 
+            [=](const int idx) restrict(amp) { return Accumulator(input_view[concurrency::index<1>(idx)]); }, binary_op);
+    }
+
+    template <typename Accumulator, typename InputIndexableView, typename BinaryFunction>
+    Accumulator accumulate(const InputIndexableView &input_view, const BinaryFunction &binary_op)
+    {
+        return accumulate<Accumulator>(_details::auto_select_target(), input_view, binary_op);
+    }
+
+    template <typename Accumulator, typename InputIndexableView>
+    Accumulator accumulate(const InputIndexableView &input_view)
+    {
+        return accumulate<Accumulator>(_details::auto_select_target(), input_view, amp_algorithms::plus<Accumulator>());
+    }
+
+    //----------------------------------------------------------------------------
+    // scan
+    //----------------------------------------------------------------------------
+
+    // This header needs these enums but they also have to be defined in the _impl header for use by the 
+    // main STL header, which includes the _impl.
+#if !defined(AMP_ALGORITHMS_ENUMS)
+#define AMP_ALGORITHMS_ENUMS
+    enum class scan_mode : int
+    {
+        exclusive = 0,
+        inclusive = 1
+    };
+
+    enum class scan_direction : int
+    {
+        forward = 0,
+        backward = 1
+    };
+#endif
+
+    template <int TileSize, scan_mode _Mode, typename _BinaryFunc, typename InputIndexableView>
+    inline void scan(const InputIndexableView& input_view, InputIndexableView& output_view, const _BinaryFunc& op)
+    {
+        _details::scan<TileSize, _Mode, _BinaryFunc>(_details::auto_select_target(), input_view, output_view, op);
+    }
+
+    template <typename IndexableView>
+    void scan_exclusive(const concurrency::accelerator_view& accl_view, const IndexableView& input_view, IndexableView& output_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        _details::scan<_details::scan_default_tile_size, amp_algorithms::scan_mode::exclusive>(accl_view, input_view, output_view, amp_algorithms::plus<IndexableView::value_type>());
+    }
+
+    template <typename IndexableView>
+    void scan_exclusive(const IndexableView& input_view, IndexableView& output_view)
+    {
+        _details::scan<_details::scan_default_tile_size, amp_algorithms::scan_mode::exclusive>(_details::auto_select_target(), input_view, output_view, amp_algorithms::plus<typename IndexableView::value_type>());
+    }
+
+    template <typename IndexableView>
+    void scan_inclusive(const concurrency::accelerator_view& accl_view, const IndexableView& input_view, IndexableView& output_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        _details::scan<_details::scan_default_tile_size, amp_algorithms::scan_mode::inclusive>(accl_view, input_view, output_view, amp_algorithms::plus<IndexableView::value_type>());
+    }
+
+    template <typename IndexableView>
+    void scan_inclusive(const IndexableView& input_view, IndexableView& output_view)
+    {
+        _details::scan<_details::scan_default_tile_size, amp_algorithms::scan_mode::inclusive>(_details::auto_select_target(), input_view, output_view, amp_algorithms::plus<typename IndexableView::value_type>());
+    }
+
+    namespace _details
+    {
+        // Scans in Accumulator rather than the element type and converts the results back on the way out.
+        template <scan_mode _Mode, typename Accumulator, typename InputIndexableView, typename OutputIndexableView>
+        inline void accumulator_scan(const concurrency::accelerator_view& accl_view, const InputIndexableView& input_view, OutputIndexableView& output_view)
+        {
+            typedef typename std::remove_const<typename indexable_view_traits<OutputIndexableView>::value_type>::type T;
+
+            if (input_view.extent.size() == 0)
+            {
+                return;
+            }
+            const _details::scratch_array<Accumulator> accumulators(input_view.extent.size(), accl_view);
+            concurrency::array_view<Accumulator, 1> accumulators_vw = accumulators.view();
+            _details::parallel_for_each(accl_view, accumulators_vw.extent, [=](concurrency::index<1> idx) restrict(amp)
+            {
+                accumulators_vw[idx] = Accumulator(input_view[idx]);
+            });
+
+            _details::scan<_details::scan_default_tile_size, _Mode>(accl_view, accumulators_vw, accumulators_vw, amp_algorithms::plus<Accumulator>());
+
+            _details::parallel_for_each(accl_view, output_view.extent, [=](concurrency::index<1> idx) restrict(amp)
+            {
+                output_view[idx] = _details::accumulator_value<T>(accumulators_vw[idx]);
+            });
+        }
+    } // namespace _details
+
+    // Scan overloads that accumulate in an explicitly specified Accumulator type, for example 
+    // scan_inclusive<neumaier_sum<float>>(input_view, output_view). See accumulate().
+    template <typename Accumulator, typename InputIndexableView, typename OutputIndexableView>
+    void scan_exclusive(const concurrency::accelerator_view& accl_view, const InputIndexableView& input_view, OutputIndexableView& output_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        _details::accumulator_scan<amp_algorithms::scan_mode::exclusive, Accumulator>(accl_view, input_view, output_view);
+    }
+
+    template <typename Accumulator, typename InputIndexableView, typename OutputIndexableView>
+    void scan_exclusive(const InputIndexableView& input_view, OutputIndexableView& output_view)
+    {
+        _details::accumulator_scan<amp_algorithms::scan_mode::exclusive, Accumulator>(_details::auto_select_target(), input_view, output_view);
+    }
+
+    template <typename Accumulator, typename InputIndexableView, typename OutputIndexableView>
+    void scan_inclusive(const concurrency::accelerator_view& accl_view, const InputIndexableView& input_view, OutputIndexableView& output_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        _details::accumulator_scan<amp_algorithms::scan_mode::inclusive, Accumulator>(accl_view, input_view, output_view);
+    }
+
+    template <typename Accumulator, typename InputIndexableView, typename OutputIndexableView>
+    void scan_inclusive(const InputIndexableView& input_view, OutputIndexableView& output_view)
+    {
+        _details::accumulator_scan<amp_algorithms::scan_mode::inclusive, Accumulator>(_details::auto_select_target(), input_view, output_view);
+    }
+
+    //----------------------------------------------------------------------------
+    // transform (unary)
+    //----------------------------------------------------------------------------
+
+    template <typename ConstInputIndexableView, typename OutputIndexableView, typename UnaryFunc>
+    void transform(const concurrency::accelerator_view &accl_view, const ConstInputIndexableView& input_view, OutputIndexableView& output_view, const UnaryFunc& func)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        _details::for_each_index(accl_view, output_view.extent, [input_view,output_view,func] (concurrency::index<indexable_view_traits<OutputIndexableView>::rank> idx) restrict(amp) {
+            output_view[idx] = func(input_view[idx]);
+        });
+    }
+
+    template <typename ConstInputIndexableView, typename OutputIndexableView, typename UnaryFunc>
+    void transform(const ConstInputIndexableView& input_view, OutputIndexableView& output_view, const UnaryFunc& func)
+    {
+        ::amp_algorithms::transform(_details::auto_select_target(), input_view, output_view, func);
+    }
+
+    //----------------------------------------------------------------------------
+    // transform (binary)
+    //----------------------------------------------------------------------------
+
+    template <typename ConstInputIndexableView1, typename ConstInputIndexableView2, typename OutputIndexableView, typename BinaryFunc>
+    void transform(const concurrency::accelerator_view &accl_view, const ConstInputIndexableView1& input_view1, const ConstInputIndexableView2& input_view2, OutputIndexableView& output_view, const BinaryFunc& func)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        _details::for_each_index(accl_view, output_view.extent, [input_view1,input_view2,output_view,func] (concurrency::index<indexable_view_traits<OutputIndexableView>::rank> idx) restrict(amp) {
+            output_view[idx] = func(input_view1[idx], input_view2[idx]);
+        });
+    }
+
+    template <typename ConstInputIndexableView1, typename ConstInputIndexableView2, typename OutputIndexableView, typename BinaryFunc>
+    void transform(const ConstInputIndexableView1& input_view1, const ConstInputIndexableView2& input_view2, OutputIndexableView& output_view, const BinaryFunc& func)
+    {
+        ::amp_algorithms::transform(_details::auto_select_target(), input_view1, input_view2, output_view, func);
+    }
+
+    //----------------------------------------------------------------------------
+    // packed_array_view overloads
+    //----------------------------------------------------------------------------
+    //
+    // Each thread loads or stores whole words of a packed_array_view rather than single elements.
+
+    namespace _details
+    {
+        template <typename T, typename Result, typename UnaryFunction, typename BinaryFunction>
+        Result packed_transform_reduce(const concurrency::accelerator_view &accl_view, const packed_array_view<T>& input_view, 
+            const UnaryFunction &transform_op, const BinaryFunction &binary_op)
+        {
+            typedef packed_element<T> element;
+            const int element_count = input_view.extent.size();
+            const concurrency::array_view<const unsigned int> words = input_view.words();
+
+            return _details::transform_reduce<512, 10000, Result>(accl_view, input_view.word_count(), [=](const int idx) restrict(amp)
+            {
+                const unsigned int word = words[idx];
+                const int slot_count = amp_algorithms::min<int>()(element::per_word, element_count - (idx * element::per_word));
+                Result value = transform_op(element::get(word, 0));
+                for (int slot = 1; slot < slot_count; ++slot)
+                {
+                    value = binary_op(value, transform_op(element::get(word, slot)));
+                }
+                return value;
+            }, binary_op);
+        }
+
+        // A tile counts into tile_static bins when there are no more bins than threads in the tile.
+        template <int tile_size, int max_tiles, typename T>
+        void packed_histogram(const concurrency::accelerator_view &accl_view, const packed_array_view<T>& input_view, 
+            const concurrency::array_view<unsigned int>& bins_view, std::true_type)
+        {
+            typedef packed_element<T> element;
+            static const int bin_count = 1 << element::bit_width;
+            const int element_count = input_view.extent.size();
+            const int word_count = input_view.word_count();
+            const int tile_count = std::min((word_count + tile_size - 1) / tile_size, max_tiles);
+            const int thread_count = tile_count * tile_size;
+            const concurrency::array_view<const unsigned int> words = input_view.words();
+
+            _details::parallel_for_each(accl_view, concurrency::extent<1>(thread_count).tile<tile_size>(), 
+                [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                tile_static unsigned int tile_bins[bin_count];
+                const int lidx = tidx.local[0];
+                if (lidx < bin_count)
+                {
+                    tile_bins[lidx] = 0;
+                }
+                tidx.barrier.wait_with_tile_static_memory_fence();
+
+                for (int idx = tidx.global[0]; idx < word_count; idx += thread_count)
+                {
+                    const unsigned int word = words[idx];
+                    const int slot_count = amp_algorithms::min<int>()(element::per_word, element_count - (idx * element::per_word));
+                    for (int slot = 0; slot < slot_count; ++slot)
+                    {
+                        concurrency::atomic_fetch_inc(&tile_bins[element::get(word, slot)]);
+                    }
+                }
+                tidx.barrier.wait_with_tile_static_memory_fence();
+
+                if ((lidx < bin_count) && (tile_bins[lidx] != 0))
+                {
+                    concurrency::atomic_fetch_add(&bins_view[lidx], tile_bins[lidx]);
+                }
+            });
+        }
+
+        template <int tile_size, int max_tiles, typename T>
+        void packed_histogram(const concurrency::accelerator_view &accl_view, const packed_array_view<T>& input_view, 
+            const concurrency::array_view<unsigned int>& bins_view, std::false_type)
+        {
+            typedef packed_element<T> element;
+            const int element_count = input_view.extent.size();
+            const concurrency::array_view<const unsigned int> words = input_view.words();
+
+            _details::parallel_for_each(accl_view, concurrency::extent<1>(input_view.word_count()), [=](concurrency::index<1> idx) restrict(amp)
+            {
+                const unsigned int word = words[idx];
+                const int slot_count = amp_algorithms::min<int>()(element::per_word, element_count - (idx[0] * element::per_word));
+                for (int slot = 0; slot < slot_count; ++slot)
+                {
+                    concurrency::atomic_fetch_inc(&bins_view[element::get(word, slot)]);
+                }
+            });
+        }
+
+        template <typename T>
+        void packed_histogram(const concurrency::accelerator_view &accl_view, const packed_array_view<T>& input_view, const concurrency::array_view<unsigned int>& bins_view)
+        {
+            static const int tile_size = 256;
+            amp_algorithms::fill(accl_view, bins_view, 0u);
+            if (input_view.extent.size() == 0)
+            {
+                return;
+            }
+            packed_histogram<tile_size, 1024>(accl_view, input_view, bins_view, 
+                std::integral_constant<bool, ((1 << packed_element<T>::bit_width) <= tile_size)>());
+        }
+    } // namespace _details
+
+    template <typename T, typename UnaryFunc>
+    void transform(const concurrency::accelerator_view &accl_view, const packed_array_view<T>& input_view, packed_array_view<T>& output_view, const UnaryFunc& func)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef _details::packed_element<T> element;
+        if (input_view.extent != output_view.extent)
+        {
+            throw concurrency::runtime_exception("The input and output views must have the same extent.", E_INVALIDARG);
+        }
+        if (output_view.extent.size() == 0)
+        {
+            return;
+        }
+        const concurrency::array_view<const unsigned int> input_words = input_view.words();
+        const concurrency::array_view<unsigned int> output_words = output_view.words();
+
+        _details::for_each_index(accl_view, output_view.word_count(), [=](const int idx) restrict(amp)
+        {
+            const unsigned int word = input_words[idx];
+            unsigned int result = 0;
+            for (int slot = 0; slot < element::per_word; ++slot)
+            {
+                result |= element::put(func(element::get(word, slot)), slot);
+            }
+            output_words[idx] = result;
+        });
+    }
+
+    template <typename T, typename UnaryFunc>
+    void transform(const packed_array_view<T>& input_view, packed_array_view<T>& output_view, const UnaryFunc& func)
+    {
+        ::amp_algorithms::transform(_details::auto_select_target(), input_view, output_view, func);
+    }
+
+    template <typename T, typename BinaryFunction>
+    typename std::result_of<BinaryFunction(const unsigned int&, const unsigned int&)>::type
+        reduce(const concurrency::accelerator_view &accl_view, const packed_array_view<T>& input_view, const BinaryFunction &binary_op)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::result_of<BinaryFunction(const unsigned int&, const unsigned int&)>::type result_type;
+        return _details::packed_transform_reduce<T, result_type>(accl_view, input_view, 
+            [](const unsigned int value) restrict(amp) { return result_type(value); }, binary_op);
+    }
+
+    template <typename T, typename BinaryFunction>
+    typename std::result_of<BinaryFunction(const unsigned int&, const unsigned int&)>::type
+        reduce(const packed_array_view<T>& input_view, const BinaryFunction &binary_op)
+    {
+        return ::amp_algorithms::reduce(_details::auto_select_target(), input_view, binary_op);
+    }
+
+    template <typename T, typename UnaryFunction, typename BinaryFunction>
+    typename std::result_of<UnaryFunction(const unsigned int&)>::type
+        transform_reduce(const concurrency::accelerator_view &accl_view, const packed_array_view<T>& input_view, const UnaryFunction &transform_op, const BinaryFunction &binary_op)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::result_of<UnaryFunction(const unsigned int&)>::type result_type;
+        return _details::packed_transform_reduce<T, result_type>(accl_view, input_view, transform_op, binary_op);
+    }
+
+    template <typename T, typename UnaryFunction, typename BinaryFunction>
+    typename std::result_of<UnaryFunction(const unsigned int&)>::type
+        transform_reduce(const packed_array_view<T>& input_view, const UnaryFunction &transform_op, const BinaryFunction &binary_op)
+    {
+        return ::amp_algorithms::transform_reduce(_details::auto_select_target(), input_view, transform_op, binary_op);
+    }
+
+    // Counts the elements of input_view with each value. bins_view must have an element for every value of T.
+    template <typename T>
+    void histogram(const concurrency::accelerator_view &accl_view, const packed_array_view<T>& input_view, concurrency::array_view<unsigned int>& bins_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        if (bins_view.extent[0] != (1 << _details::packed_element<T>::bit_width))
+        {
+            throw concurrency::runtime_exception("The bins view must have an element for every value of the element type.", E_INVALIDARG);
+        }
+        _details::packed_histogram(accl_view, input_view, bins_view);
+    }
+
+    template <typename T>
+    void histogram(const packed_array_view<T>& input_view, concurrency::array_view<unsigned int>& bins_view)
+    {
+        ::amp_algorithms::histogram(_details::auto_select_target(), input_view, bins_view);
+    }
+
+    // A counting sort. The element values are histogrammed and scanned, then each thread writes a whole output 
+    // word by searching the scanned counts for the value at each position. The input is not read after the 
+    // histogram so output_view may be input_view.
+    template <typename T>
+    inline void radix_sort(const concurrency::accelerator_view& accl_view, const packed_array_view<T>& input_view, packed_array_view<T>& output_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef _details::packed_element<T> element;
+        static const int bin_count = 1 << element::bit_width;
+        const int element_count = input_view.extent.size();
+        if (output_view.extent.size() != element_count)
+        {
+            throw concurrency::runtime_exception("The input and output views must have the same size.", E_INVALIDARG);
+        }
+        if (element_count == 0)
+        {
+            return;
+        }
+
+        const _details::scratch_array<unsigned int> offsets(bin_count, accl_view);
+        concurrency::array_view<unsigned int> offsets_vw = offsets.view();
+        _details::packed_histogram(accl_view, input_view, offsets_vw);
+        _details::scan<_details::scan_default_tile_size, amp_algorithms::scan_mode::inclusive>(accl_view, offsets_vw, offsets_vw, amp_algorithms::plus<unsigned int>());
+
+        // offsets_vw[v] is now the position after the last element with value v.
+        const concurrency::array_view<unsigned int> output_words = output_view.words();
+        _details::parallel_for_each(accl_view, concurrency::extent<1>(output_view.word_count()), [=](concurrency::index<1> idx) restrict(amp)
+        {
+            unsigned int result = 0;
+            for (int slot = 0; slot < element::per_word; ++slot)
+            {
+                const unsigned int position = (idx[0] * element::per_word) + slot;
+                int first = 0;
+                int last = bin_count - 1;
+                while (first < last)
+                {
+                    const int middle = (first + last) / 2;
+                    if (offsets_vw[middle] > position)
+                    {
+                        last = middle;
+                    }
+                    else
+                    {
+                        first = middle + 1;
+                    }
+                }
+                result |= element::put(first, slot);
+            }
+            output_words[idx] = result;
+        });
+    }
+
+    template <typename T>
+    inline void radix_sort(const packed_array_view<T>& input_view, packed_array_view<T>& output_view)
+    {
+        radix_sort(_details::auto_select_target(), input_view, output_view);
+    }
+
+    template <typename T>
+    inline void radix_sort(const concurrency::accelerator_view& accl_view, packed_array_view<T>& input_view)
+    {
+        radix_sort(accl_view, input_view, input_view);
+    }
+
+    template <typename T>
+    inline void radix_sort(packed_array_view<T>& input_view)
+    {
+        radix_sort(_details::auto_select_target(), input_view, input_view);
+    }
+
+    //----------------------------------------------------------------------------
+    // count_if
+    //----------------------------------------------------------------------------
+
+    template <typename InputIndexableView, typename UnaryPredicate>
+    int count_if(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const UnaryPredicate &pred)
+    {
+        typedef typename indexable_view_traits<InputIndexableView>::value_type value_type;
+        return ::amp_algorithms::transform_reduce(accl_view, input_view, 
+            [=](const value_type& value) restrict(amp) { return pred(value) ? 1 : 0; }, amp_algorithms::plus<int>());
+    }
+
+    template <typename InputIndexableView, typename UnaryPredicate>
+    int count_if(const InputIndexableView &input_view, const UnaryPredicate &pred)
+    {
+        return ::amp_algorithms::count_if(_details::auto_select_target(), input_view, pred);
+    }
+
+    //----------------------------------------------------------------------------
+    // Asynchronous variants
+    //----------------------------------------------------------------------------
+    //
+    // These queue their kernels on accl_view and return without waiting for them to run. Results stay in 
+    // accelerator memory: reductions write theirs to result_view[0] rather than returning it. The returned 
+    // completion_future is a marker on accl_view that becomes ready once all the work queued so far has 
+    // completed. An output array_view over host memory must still be synchronized, for example with 
+    // synchronize_async(), before its data source is read. The views passed in must remain valid until then.
+
+    template <typename OutputIndexableView, typename T>
+    concurrency::completion_future fill_async(const concurrency::accelerator_view &accl_view, OutputIndexableView& output_view, const T& value)
+    {
+        ::amp_algorithms::fill(accl_view, output_view, value);
+        return accl_view.create_marker();
+    }
+
+    template <typename OutputIndexableView, typename T>
+    concurrency::completion_future fill_async(OutputIndexableView& output_view, const T& value)
+    {
+        return ::amp_algorithms::fill_async(_details::auto_select_target(), output_view, value);
+    }
+
+    template <typename OutputIndexableView, typename Generator>
+    concurrency::completion_future generate_async(const concurrency::accelerator_view &accl_view, OutputIndexableView& output_view, const Generator& generator)
+    {
+        ::amp_algorithms::generate(accl_view, output_view, generator);
+        return accl_view.create_marker();
+    }
+
+    template <typename OutputIndexableView, typename Generator>
+    concurrency::completion_future generate_async(OutputIndexableView& output_view, const Generator& generator)
+    {
+        return ::amp_algorithms::generate_async(_details::auto_select_target(), output_view, generator);
+    }
+
+    template <typename ConstInputIndexableView, typename OutputIndexableView, typename UnaryFunc>
+    concurrency::completion_future transform_async(const concurrency::accelerator_view &accl_view, const ConstInputIndexableView& input_view, OutputIndexableView& output_view, const UnaryFunc& func)
+    {
+        ::amp_algorithms::transform(accl_view, input_view, output_view, func);
+        return accl_view.create_marker();
+    }
+
+    template <typename ConstInputIndexableView, typename OutputIndexableView, typename UnaryFunc>
+    concurrency::completion_future transform_async(const ConstInputIndexableView& input_view, OutputIndexableView& output_view, const UnaryFunc& func)
+    {
+        return ::amp_algorithms::transform_async(_details::auto_select_target(), input_view, output_view, func);
+    }
+
+    template <typename ConstInputIndexableView1, typename ConstInputIndexableView2, typename OutputIndexableView, typename BinaryFunc>
+    concurrency::completion_future transform_async(const concurrency::accelerator_view &accl_view, const ConstInputIndexableView1& input_view1, const ConstInputIndexableView2& input_view2, OutputIndexableView& output_view, const BinaryFunc& func)
+    {
+        ::amp_algorithms::transform(accl_view, input_view1, input_view2, output_view, func);
+        return accl_view.create_marker();
+    }
+
+    template <typename ConstInputIndexableView1, typename ConstInputIndexableView2, typename OutputIndexableView, typename BinaryFunc>
+    concurrency::completion_future transform_async(const ConstInputIndexableView1& input_view1, const ConstInputIndexableView2& input_view2, OutputIndexableView& output_view, const BinaryFunc& func)
+    {
+        return ::amp_algorithms::transform_async(_details::auto_select_target(), input_view1, input_view2, output_view, func);
+    }
+
+    template <typename IndexableView>
+    concurrency::completion_future scan_exclusive_async(const concurrency::accelerator_view& accl_view, const IndexableView& input_view, IndexableView& output_view)
+    {
+        ::amp_algorithms::scan_exclusive(accl_view, input_view, output_view);
+        return accl_view.create_marker();
+    }
+
+    template <typename IndexableView>
+    concurrency::completion_future scan_exclusive_async(const IndexableView& input_view, IndexableView& output_view)
+    {
+        return ::amp_algorithms::scan_exclusive_async(_details::auto_select_target(), input_view, output_view);
+    }
+
+    template <typename IndexableView>
+    concurrency::completion_future scan_inclusive_async(const concurrency::accelerator_view& accl_view, const IndexableView& input_view, IndexableView& output_view)
+    {
+        ::amp_algorithms::scan_inclusive(accl_view, input_view, output_view);
+        return accl_view.create_marker();
+    }
+
+    template <typename IndexableView>
+    concurrency::completion_future scan_inclusive_async(const IndexableView& input_view, IndexableView& output_view)
+    {
+        return ::amp_algorithms::scan_inclusive_async(_details::auto_select_target(), input_view, output_view);
+    }
+
+    template <int TileSize, scan_mode _Mode, typename _BinaryFunc, typename InputIndexableView>
+    concurrency::completion_future scan_async(const concurrency::accelerator_view& accl_view, const InputIndexableView& input_view, InputIndexableView& output_view, const _BinaryFunc& op)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        _details::scan<TileSize, _Mode, _BinaryFunc>(accl_view, input_view, output_view, op);
+        return accl_view.create_marker();
+    }
+
+    template <int TileSize, scan_mode _Mode, typename _BinaryFunc, typename InputIndexableView>
+    concurrency::completion_future scan_async(const InputIndexableView& input_view, InputIndexableView& output_view, const _BinaryFunc& op)
+    {
+        return ::amp_algorithms::scan_async<TileSize, _Mode>(_details::auto_select_target(), input_view, output_view, op);
+    }
+
+    // The sorted data ends up in output_view, as for radix_sort(). Both views are used as scratch space.
+    template <typename T>
+    concurrency::completion_future radix_sort_async(const concurrency::accelerator_view& accl_view, concurrency::array_view<T>& input_view, concurrency::array_view<T>& output_view)
+    {
+        ::amp_algorithms::radix_sort(accl_view, input_view, output_view);
+        return accl_view.create_marker();
+    }
+
+    template <typename T>
+    concurrency::completion_future radix_sort_async(concurrency::array_view<T>& input_view, concurrency::array_view<T>& output_view)
+    {
+        return ::amp_algorithms::radix_sort_async(_details::auto_select_target(), input_view, output_view);
+    }
+
+    // Writes the reduction of a rank 1 view to result_view[0]. An empty input leaves result_view unchanged.
+    template <typename InputIndexableView, typename BinaryFunction, typename T>
+    concurrency::completion_future reduce_async(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op, 
+        const concurrency::array_view<T> &result_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        static_assert(indexable_view_traits<InputIndexableView>::rank == 1, "The input indexable view must be of rank 1");
+        const int tile_size = 512;
+        _details::transform_reduce_async<tile_size, 10000, T>(accl_view, input_view.extent.size(), 
+            [=](const int idx) restrict(amp) { return input_view[concurrency::index<1>(idx)]; }, binary_op, result_view);
+        return accl_view.create_marker();
+    }
+
+    template <typename InputIndexableView, typename BinaryFunction, typename T>
+    concurrency::completion_future reduce_async(const InputIndexableView &input_view, const BinaryFunction &binary_op, const concurrency::array_view<T> &result_view)
+    {
+        return ::amp_algorithms::reduce_async(_details::auto_select_target(), input_view, binary_op, result_view);
+    }
+
+    template <typename InputIndexableView, typename BinaryFunction, typename OutputIndexableView>
+    concurrency::completion_future reduce_async(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const int axis, const BinaryFunction &binary_op, 
+        OutputIndexableView &output_view)
+    {
+        ::amp_algorithms::reduce(accl_view, input_view, axis, binary_op, output_view);
+        return accl_view.create_marker();
+    }
+
+    template <typename InputIndexableView, typename BinaryFunction, typename OutputIndexableView>
+    concurrency::completion_future reduce_async(const InputIndexableView &input_view, const int axis, const BinaryFunction &binary_op, OutputIndexableView &output_view)
+    {
+        return ::amp_algorithms::reduce_async(_details::auto_select_target(), input_view, axis, binary_op, output_view);
+    }
+
+    // Writes the same bitwise reproducible result as reproducible_reduce() to result_view[0].
+    template <typename InputIndexableView, typename BinaryFunction, typename T>
+    concurrency::completion_future reproducible_reduce_async(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op, 
+        const concurrency::array_view<T> &result_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        const int tile_size = 256;
+        const int items_per_thread = 4;
+        _details::reproducible_reduce_async<tile_size, items_per_thread>(accl_view, input_view, binary_op, result_view);
+        return accl_view.create_marker();
+    }
+
+    template <typename InputIndexableView, typename BinaryFunction, typename T>
+    concurrency::completion_future reproducible_reduce_async(const InputIndexableView &input_view, const BinaryFunction &binary_op, const concurrency::array_view<T> &result_view)
+    {
+        return ::amp_algorithms::reproducible_reduce_async(_details::auto_select_target(), input_view, binary_op, result_view);
+    }
+
+    // The accumulator type is that of result_view, see accumulate().
+    template <typename Accumulator, typename InputIndexableView, typename BinaryFunction>
+    concurrency::completion_future accumulate_async(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op, 
+        const concurrency::array_view<Accumulator> &result_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        static_assert(indexable_view_traits<InputIndexableView>::rank == 1, "The input indexable view must be of rank 1");
+        const int tile_size = 512;
+        _details::transform_reduce_async<tile_size, 10000, Accumulator>(accl_view, input_view.extent.size(), 
+            [=](const int idx) restrict(amp) { return Accumulator(input_view[concurrency::index<1>(idx)]); }, binary_op, result_view);
+        return accl_view.create_marker();
+    }
+
+    template <typename Accumulator, typename InputIndexableView, typename BinaryFunction>
+    concurrency::completion_future accumulate_async(const InputIndexableView &input_view, const BinaryFunction &binary_op, const concurrency::array_view<Accumulator> &result_view)
+    {
+        return ::amp_algorithms::accumulate_async(_details::auto_select_target(), input_view, binary_op, result_view);
+    }
+
+    template <typename InputIndexableView, typename OffsetsIndexableView, typename BinaryFunction, typename OutputIndexableView>
+    concurrency::completion_future segmented_reduce_async(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, 
+        const OffsetsIndexableView &offsets_view, const BinaryFunction &binary_op, OutputIndexableView &output_view)
+    {
+        ::amp_algorithms::segmented_reduce(accl_view, input_view, offsets_view, binary_op, output_view);
+        return accl_view.create_marker();
+    }
+
+    template <typename InputIndexableView, typename OffsetsIndexableView, typename BinaryFunction, typename OutputIndexableView>
+    concurrency::completion_future segmented_reduce_async(const InputIndexableView &input_view, const OffsetsIndexableView &offsets_view, const BinaryFunction &binary_op, 
+        OutputIndexableView &output_view)
+    {
+        return ::amp_algorithms::segmented_reduce_async(_details::auto_select_target(), input_view, offsets_view, binary_op, output_view);
+    }
+
+    template <typename InputIndexableView, typename UnaryFunction, typename BinaryFunction, typename T>
+    concurrency::completion_future transform_reduce_async(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const UnaryFunction &transform_op, 
+        const BinaryFunction &binary_op, const concurrency::array_view<T> &result_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        static_assert(indexable_view_traits<InputIndexableView>::rank == 1, "The input indexable view must be of rank 1");
+        const int tile_size = 512;
+        _details::transform_reduce_async<tile_size, 10000, T>(accl_view, input_view.extent.size(), 
+            [=](const int idx) restrict(amp) { return transform_op(input_view[concurrency::index<1>(idx)]); }, binary_op, result_view);
+        return accl_view.create_marker();
+    }
+
+    template <typename InputIndexableView, typename UnaryFunction, typename BinaryFunction, typename T>
+    concurrency::completion_future transform_reduce_async(const InputIndexableView &input_view, const UnaryFunction &transform_op, const BinaryFunction &binary_op, 
+        const concurrency::array_view<T> &result_view)
+    {
+        return ::amp_algorithms::transform_reduce_async(_details::auto_select_target(), input_view, transform_op, binary_op, result_view);
+    }
+
+    // Writes the statistics of describe() to result_view[0], including the zero count of an empty input.
+    template <typename InputIndexableView, typename T>
+    concurrency::completion_future describe_async(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, 
+        const concurrency::array_view<descriptive_statistics<T>> &result_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        if (input_view.extent.size() == 0)
+        {
+            const descriptive_statistics<T> s = {};
+            concurrency::array_view<descriptive_statistics<T>> first_vw = result_view.section(0, 1);
+            ::amp_algorithms::fill(accl_view, first_vw, s);
+            return accl_view.create_marker();
+        }
+        return ::amp_algorithms::transform_reduce_async(accl_view, input_view, _details::describe_load<T>(), _details::describe_combine<T>(), result_view);
+    }
+
+    template <typename InputIndexableView, typename T>
+    concurrency::completion_future describe_async(const InputIndexableView &input_view, const concurrency::array_view<descriptive_statistics<T>> &result_view)
+    {
+        return ::amp_algorithms::describe_async(_details::auto_select_target(), input_view, result_view);
     }
 } // namespace amp_algorithms
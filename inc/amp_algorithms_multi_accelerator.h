@@ -0,0 +1,317 @@
+/*----------------------------------------------------------------------------
+* Copyright (c) Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+* C++ AMP algorithms library.
+*
+* This file contains the C++ AMP algorithms that split their work across 
+* several accelerator_views.
+*---------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <amp.h>
+#include <chrono>
+#include <future>
+#include <utility>
+#include <vector>
+
+#include <amp_algorithms.h>
+
+namespace amp_algorithms
+{
+    //----------------------------------------------------------------------------
+    // accelerator_view_set
+    //----------------------------------------------------------------------------
+
+    // A set of accelerator_views that the algorithms in this header split a range across. Each view receives 
+    // a contiguous share of the elements in proportion to its weight. Weights start out equal and can either 
+    // be given explicitly or measured with calibrate().
+    class accelerator_view_set
+    {
+    public:
+        explicit accelerator_view_set(const std::vector<concurrency::accelerator_view>& views) : 
+            m_views(views), m_weights(views.size(), 1.0)
+        {
+            if (m_views.empty())
+            {
+                throw concurrency::runtime_exception("An accelerator_view_set needs at least one accelerator_view.", E_INVALIDARG);
+            }
+        }
+
+        accelerator_view_set(const std::vector<concurrency::accelerator_view>& views, const std::vector<double>& weights) : 
+            m_views(views), m_weights(views.size(), 1.0)
+        {
+            if (m_views.empty())
+            {
+                throw concurrency::runtime_exception("An accelerator_view_set needs at least one accelerator_view.", E_INVALIDARG);
+            }
+            set_weights(weights);
+        }
+
+        // The default views of all the accelerators that can run kernels at a useful speed, which excludes the 
+        // CPU and reference accelerators.
+        static accelerator_view_set all_accelerators()
+        {
+            std::vector<concurrency::accelerator_view> views;
+            for (const auto& accl : concurrency::accelerator::get_all())
+            {
+                if ((accl.device_path != concurrency::accelerator::cpu_accelerator) && (accl.device_path != concurrency::accelerator::direct3d_ref))
+                {
+                    views.push_back(accl.default_view);
+                }
+            }
+            return accelerator_view_set(views);
+        }
+
+        size_t size() const
+        {
+            return m_views.size();
+        }
+
+        const concurrency::accelerator_view& view(size_t i) const
+        {
+            return m_views[i];
+        }
+
+        double weight(size_t i) const
+        {
+            return m_weights[i];
+        }
+
+        void set_weights(const std::vector<double>& weights)
+        {
+            if (weights.size() != m_views.size())
+            {
+                throw concurrency::runtime_exception("There must be one weight per accelerator_view.", E_INVALIDARG);
+            }
+            double total = 0.0;
+            for (auto w : weights)
+            {
+                if (!(w >= 0.0))
+                {
+                    throw concurrency::runtime_exception("Weights must not be negative.", E_INVALIDARG);
+                }
+                total += w;
+            }
+            if (total <= 0.0)
+            {
+                throw concurrency::runtime_exception("At least one weight must be positive.", E_INVALIDARG);
+            }
+            m_weights = weights;
+        }
+
+        // Sets each view's weight to its measured throughput for a sum of sample_size integers. The data is 
+        // copied to each accelerator and the shader compiled before timing starts, so only the kernel and the 
+        // read back of the result are measured.
+        void calibrate(int sample_size = 1 << 22)
+        {
+            const std::vector<int> sample(sample_size, 1);
+            std::vector<double> weights(m_views.size());
+            for (size_t i = 0; i < m_views.size(); ++i)
+            {
+                concurrency::array<int> data(sample_size, std::begin(sample), std::end(sample), m_views[i]);
+                const concurrency::array_view<const int> data_vw(data);
+                amp_algorithms::reduce(m_views[i], data_vw, amp_algorithms::plus<int>());
+
+                const auto start = std::chrono::high_resolution_clock::now();
+                amp_algorithms::reduce(m_views[i], data_vw, amp_algorithms::plus<int>());
+                const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+
+                weights[i] = 1.0 / ((elapsed.count() > 1e-9) ? elapsed.count() : 1e-9);
+            }
+            set_weights(weights);
+        }
+
+        // Splits [0, element_count) into one (offset, count) range per view, in view order and in proportion to 
+        // the weights. Ranges for views with a small weight may be empty.
+        std::vector<std::pair<int, int>> partition(int element_count) const
+        {
+            double total = 0.0;
+            for (auto w : m_weights)
+            {
+                total += w;
+            }
+
+            std::vector<std::pair<int, int>> ranges(m_views.size());
+            double cumulative = 0.0;
+            int offset = 0;
+            for (size_t i = 0; i < m_views.size(); ++i)
+            {
+                cumulative += m_weights[i];
+                const int end = (i == m_views.size() - 1) ? element_count : static_cast<int>((element_count * cumulative) / total + 0.5);
+                ranges[i] = std::make_pair(offset, end - offset);
+                offset = end;
+            }
+            return ranges;
+        }
+
+    private:
+        std::vector<concurrency::accelerator_view> m_views;
+        std::vector<double> m_weights;
+    };
+
+    namespace _details
+    {
+        // Runs func(accl_view, offset, count) for each non-empty range of the partition on its own thread, so 
+        // that the kernels for different views are dispatched and run concurrently. The futures are in range 
+        // order and waiting on them rethrows any exception raised by func.
+        template <typename Function>
+        std::vector<std::future<typename std::result_of<Function(concurrency::accelerator_view, int, int)>::type>>
+            launch_partitions(const accelerator_view_set& targets, const std::vector<std::pair<int, int>>& ranges, const Function& func)
+        {
+            std::vector<std::future<typename std::result_of<Function(concurrency::accelerator_view, int, int)>::type>> futures;
+            for (size_t i = 0; i < ranges.size(); ++i)
+            {
+                if (ranges[i].second > 0)
+                {
+                    futures.push_back(std::async(std::launch::async, func, targets.view(i), ranges[i].first, ranges[i].second));
+                }
+            }
+            return futures;
+        }
+    } // namespace _details
+
+    //----------------------------------------------------------------------------
+    // reduce, transform and scan across an accelerator_view_set
+    //----------------------------------------------------------------------------
+
+    // These overloads take views that support section(), as concurrency::array and array_view do.
+
+    // Reduces each view's share of the input on that view and combines the partial results on the host, in 
+    // range order. binary_op must be associative. An empty input returns a value initialized result.
+    template <typename InputIndexableView, typename BinaryFunction>
+    typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type
+        reduce(const accelerator_view_set& targets, const InputIndexableView& input_view, const BinaryFunction& binary_op)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        static_assert(indexable_view_traits<InputIndexableView>::rank == 1, "The input indexable view must be of rank 1");
+        typedef typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type result_type;
+
+        auto partials = _details::launch_partitions(targets, targets.partition(input_view.extent.size()), 
+            [=](const concurrency::accelerator_view& accl_view, int offset, int count) 
+        {
+            return amp_algorithms::reduce(accl_view, input_view.section(offset, count), binary_op);
+        });
+
+        if (partials.empty())
+        {
+            return result_type();
+        }
+        result_type result = partials[0].get();
+        for (size_t i = 1; i < partials.size(); ++i)
+        {
+            result = binary_op(result, partials[i].get());
+        }
+        return result;
+    }
+
+    // Transforms each view's share of the input on that view. Each share of the output is synchronized back to 
+    // its data source before the function returns.
+    template <typename ConstInputIndexableView, typename OutputIndexableView, typename UnaryFunc>
+    void transform(const accelerator_view_set& targets, const ConstInputIndexableView& input_view, OutputIndexableView& output_view, const UnaryFunc& func)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        static_assert(indexable_view_traits<OutputIndexableView>::rank == 1, "The output indexable view must be of rank 1");
+
+        auto done = _details::launch_partitions(targets, targets.partition(output_view.extent.size()), 
+            [=](const concurrency::accelerator_view& accl_view, int offset, int count) 
+        {
+            auto output_section = output_view.section(offset, count);
+            amp_algorithms::transform(accl_view, input_view.section(offset, count), output_section, func);
+            _details::traced_synchronize(output_section);
+        });
+
+        for (auto& d : done)
+        {
+            d.get();
+        }
+    }
+
+    namespace _details
+    {
+        // Scans each view's share of the input independently, then adds to every share after the first the 
+        // total of the shares before it. Only the last element of each share is read back to compute the 
+        // carries.
+        template <scan_mode _Mode, typename IndexableView>
+        void partitioned_scan(const accelerator_view_set& targets, const IndexableView& input_view, IndexableView& output_view)
+        {
+            static_assert(indexable_view_traits<IndexableView>::rank == 1, "The indexable view must be of rank 1");
+            typedef typename std::remove_const<typename indexable_view_traits<IndexableView>::value_type>::type T;
+
+            const auto ranges = targets.partition(output_view.extent.size());
+            auto totals = launch_partitions(targets, ranges, [=](const concurrency::accelerator_view& accl_view, int offset, int count) -> T
+            {
+                const auto input_section = input_view.section(offset, count);
+                auto output_section = output_view.section(offset, count);
+                if (_Mode == scan_mode::exclusive)
+                {
+                    // Read the last input first, the scan may be in place.
+                    const T last = input_section.section(count - 1, 1)[0];
+                    amp_algorithms::scan_exclusive(accl_view, input_section, output_section);
+                    return amp_algorithms::plus<T>()(output_section.section(count - 1, 1)[0], last);
+                }
+                amp_algorithms::scan_inclusive(accl_view, input_section, output_section);
+                return output_section.section(count - 1, 1)[0];
+            });
+
+            // Launch each carry as soon as the totals before it are known.
+            std::vector<std::future<void>> done;
+            T carry = T();
+            size_t total_index = 0;
+            for (size_t i = 0; i < ranges.size(); ++i)
+            {
+                const int offset = ranges[i].first;
+                const int count = ranges[i].second;
+                if (count == 0)
+                {
+                    continue;
+                }
+                const T c = carry;
+                carry = amp_algorithms::plus<T>()(carry, totals[total_index++].get());
+
+                const concurrency::accelerator_view accl_view = targets.view(i);
+                done.push_back(std::async(std::launch::async, [=]
+                {
+                    auto output_section = output_view.section(offset, count);
+                    if (offset > 0)
+                    {
+                        amp_algorithms::transform(accl_view, output_section, output_section, [=](const T& v) restrict(amp) { return amp_algorithms::plus<T>()(v, c); });
+                    }
+                    _details::traced_synchronize(output_section);
+                }));
+            }
+
+            for (auto& d : done)
+            {
+                d.get();
+            }
+        }
+    } // namespace _details
+
+    template <typename IndexableView>
+    void scan_exclusive(const accelerator_view_set& targets, const IndexableView& input_view, IndexableView& output_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        _details::partitioned_scan<scan_mode::exclusive>(targets, input_view, output_view);
+    }
+
+    template <typename IndexableView>
+    void scan_inclusive(const accelerator_view_set& targets, const IndexableView& input_view, IndexableView& output_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        _details::partitioned_scan<scan_mode::inclusive>(targets, input_view, output_view);
+    }
+} // namespace amp_algorithms
@@ -0,0 +1,321 @@
+/*----------------------------------------------------------------------------
+* Copyright (c) Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+*
+* C++ AMP algorithms library.
+*
+* This file contains lazy pipelines that fuse transforms, filters and a 
+* reduction into a single kernel.
+*---------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <amp.h>
+#include <type_traits>
+
+#include <amp_algorithms.h>
+
+namespace amp_algorithms
+{
+    //----------------------------------------------------------------------------
+    // Pipelines
+    //
+    // auto sum = input_view | transformed(f) | filtered(p) | reduced(amp_algorithms::plus<int>());
+    //
+    // A pipeline applies a chain of transforms and filters to a rank 1 indexable view, for example an 
+    // array_view or a functor_view. Nothing is evaluated until the chain ends in reduced() or counted(), 
+    // which run the whole chain in one kernel without writing any intermediate results. The functors are 
+    // composed at compile time.
+    //
+    // Transform and filter functors need to be blittable and callable in restrict(amp) code. The reduction 
+    // functor must be restrict(cpu, amp) as the per-tile results are combined on the host.
+    //----------------------------------------------------------------------------
+
+    namespace _details
+    {
+        // A stage computes the element of the pipeline at a source index. It returns false if a filter 
+        // dropped the element.
+
+        template <typename InputIndexableView>
+        class source_stage
+        {
+        public:
+            typedef typename std::remove_const<typename indexable_view_traits<InputIndexableView>::value_type>::type value_type;
+
+            explicit source_stage(const InputIndexableView& input_view) : m_input_view(input_view)
+            {
+            }
+
+            bool operator()(const int idx, value_type& value) const restrict(amp)
+            {
+                value = m_input_view[concurrency::index<1>(idx)];
+                return true;
+            }
+
+        private:
+            InputIndexableView m_input_view;
+        };
+
+        template <typename Stage, typename UnaryFunction>
+        class transform_stage
+        {
+        public:
+            typedef typename std::remove_const<typename std::remove_reference<
+                typename std::result_of<UnaryFunction(const typename Stage::value_type&)>::type>::type>::type value_type;
+
+            transform_stage(const Stage& stage, const UnaryFunction& func) : m_stage(stage), m_func(func)
+            {
+            }
+
+            bool operator()(const int idx, value_type& value) const restrict(amp)
+            {
+                typename Stage::value_type input;
+                if (!m_stage(idx, input))
+                {
+                    return false;
+                }
+                value = m_func(input);
+                return true;
+            }
+
+        private:
+            Stage m_stage;
+            UnaryFunction m_func;
+        };
+
+        template <typename Stage, typename UnaryPredicate>
+        class filter_stage
+        {
+        public:
+            typedef typename Stage::value_type value_type;
+
+            filter_stage(const Stage& stage, const UnaryPredicate& pred) : m_stage(stage), m_pred(pred)
+            {
+            }
+
+            bool operator()(const int idx, value_type& value) const restrict(amp)
+            {
+                return m_stage(idx, value) && m_pred(value);
+            }
+
+        private:
+            Stage m_stage;
+            UnaryPredicate m_pred;
+        };
+    } // namespace _details
+
+    template <typename Stage>
+    class pipeline
+    {
+    public:
+        typedef typename Stage::value_type value_type;
+
+        pipeline(const Stage& stage, const int element_count) : m_stage(stage), m_element_count(element_count)
+        {
+        }
+
+        const Stage& stage() const
+        {
+            return m_stage;
+        }
+
+        // The number of source elements, before any filter.
+        int size() const
+        {
+            return m_element_count;
+        }
+
+        // Reduces the elements that pass every filter. Elements dropped by a filter contribute identity, 
+        // which is also the result for an empty pipeline.
+        template <typename BinaryFunction>
+        value_type reduce(const concurrency::accelerator_view& accl_view, const BinaryFunction& binary_op, const value_type& identity) const
+        {
+            AMP_ALGORITHMS_TRACE_ALGORITHM();
+            if (m_element_count <= 0)
+            {
+                return identity;
+            }
+            static const int tile_size = 512;
+            const Stage stage = m_stage;
+            return _details::transform_reduce<tile_size, 10000, value_type>(accl_view, m_element_count, [=](const int idx) restrict(amp) -> value_type
+            {
+                value_type value;
+                return stage(idx, value) ? value : identity;
+            }, binary_op);
+        }
+
+        // The number of elements that pass every filter.
+        int count(const concurrency::accelerator_view& accl_view) const
+        {
+            AMP_ALGORITHMS_TRACE_ALGORITHM();
+            if (m_element_count <= 0)
+            {
+                return 0;
+            }
+            static const int tile_size = 512;
+            const Stage stage = m_stage;
+            return _details::transform_reduce<tile_size, 10000, int>(accl_view, m_element_count, [=](const int idx) restrict(amp)
+            {
+                value_type value;
+                return stage(idx, value) ? 1 : 0;
+            }, amp_algorithms::plus<int>());
+        }
+
+    private:
+        Stage m_stage;
+        int m_element_count;
+    };
+
+    namespace _details
+    {
+        template <typename Source>
+        struct pipeline_traits
+        {
+            typedef source_stage<Source> stage_type;
+
+            static pipeline<stage_type> as_pipeline(const Source& source)
+            {
+                static_assert(indexable_view_traits<Source>::rank == 1, "The input indexable view must be of rank 1");
+                return pipeline<stage_type>(stage_type(source), source.extent.size());
+            }
+        };
+
+        template <typename Stage>
+        struct pipeline_traits<pipeline<Stage>>
+        {
+            typedef Stage stage_type;
+
+            static const pipeline<Stage>& as_pipeline(const pipeline<Stage>& source)
+            {
+                return source;
+            }
+        };
+    } // namespace _details
+
+    // Starts a pipeline from a rank 1 indexable view. A pipeline is returned unchanged.
+    template <typename Source>
+    pipeline<typename _details::pipeline_traits<Source>::stage_type> as_pipeline(const Source& source)
+    {
+        return _details::pipeline_traits<Source>::as_pipeline(source);
+    }
+
+    //----------------------------------------------------------------------------
+    // Pipeline adaptors
+    //----------------------------------------------------------------------------
+
+    template <typename UnaryFunction>
+    struct transform_adaptor
+    {
+        UnaryFunction func;
+    };
+
+    template <typename UnaryPredicate>
+    struct filter_adaptor
+    {
+        UnaryPredicate pred;
+    };
+
+    template <typename BinaryFunction>
+    struct reduce_adaptor
+    {
+        BinaryFunction binary_op;
+    };
+
+    template <typename BinaryFunction, typename T>
+    struct reduce_with_identity_adaptor
+    {
+        BinaryFunction binary_op;
+        T identity;
+    };
+
+    struct count_adaptor
+    {
+    };
+
+    template <typename UnaryFunction>
+    transform_adaptor<UnaryFunction> transformed(const UnaryFunction& func)
+    {
+        transform_adaptor<UnaryFunction> adaptor = { func };
+        return adaptor;
+    }
+
+    template <typename UnaryPredicate>
+    filter_adaptor<UnaryPredicate> filtered(const UnaryPredicate& pred)
+    {
+        filter_adaptor<UnaryPredicate> adaptor = { pred };
+        return adaptor;
+    }
+
+    // Elements dropped by a filter contribute value_type(), use the overload that takes an identity for 
+    // operators such as min or max where that is not the identity.
+    template <typename BinaryFunction>
+    reduce_adaptor<BinaryFunction> reduced(const BinaryFunction& binary_op)
+    {
+        reduce_adaptor<BinaryFunction> adaptor = { binary_op };
+        return adaptor;
+    }
+
+    template <typename BinaryFunction, typename T>
+    reduce_with_identity_adaptor<BinaryFunction, T> reduced(const BinaryFunction& binary_op, const T& identity)
+    {
+        reduce_with_identity_adaptor<BinaryFunction, T> adaptor = { binary_op, identity };
+        return adaptor;
+    }
+
+    inline count_adaptor counted()
+    {
+        return count_adaptor();
+    }
+
+    template <typename Source, typename UnaryFunction>
+    pipeline<_details::transform_stage<typename _details::pipeline_traits<Source>::stage_type, UnaryFunction>>
+        operator|(const Source& source, const transform_adaptor<UnaryFunction>& adaptor)
+    {
+        typedef _details::transform_stage<typename _details::pipeline_traits<Source>::stage_type, UnaryFunction> stage_type;
+        const auto input = as_pipeline(source);
+        return pipeline<stage_type>(stage_type(input.stage(), adaptor.func), input.size());
+    }
+
+    template <typename Source, typename UnaryPredicate>
+    pipeline<_details::filter_stage<typename _details::pipeline_traits<Source>::stage_type, UnaryPredicate>>
+        operator|(const Source& source, const filter_adaptor<UnaryPredicate>& adaptor)
+    {
+        typedef _details::filter_stage<typename _details::pipeline_traits<Source>::stage_type, UnaryPredicate> stage_type;
+        const auto input = as_pipeline(source);
+        return pipeline<stage_type>(stage_type(input.stage(), adaptor.pred), input.size());
+    }
+
+    template <typename Source, typename BinaryFunction>
+    typename _details::pipeline_traits<Source>::stage_type::value_type
+        operator|(const Source& source, const reduce_adaptor<BinaryFunction>& adaptor)
+    {
+        typedef typename _details::pipeline_traits<Source>::stage_type::value_type value_type;
+        return as_pipeline(source).reduce(_details::auto_select_target(), adaptor.binary_op, value_type());
+    }
+
+    template <typename Source, typename BinaryFunction, typename T>
+    typename _details::pipeline_traits<Source>::stage_type::value_type
+        operator|(const Source& source, const reduce_with_identity_adaptor<BinaryFunction, T>& adaptor)
+    {
+        return as_pipeline(source).reduce(_details::auto_select_target(), adaptor.binary_op, adaptor.identity);
+    }
+
+    template <typename Source>
+    int operator|(const Source& source, const count_adaptor&)
+    {
+        return as_pipeline(source).count(_details::auto_select_target());
+    }
+} // namespace amp_algorithms
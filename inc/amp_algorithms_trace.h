@@ -0,0 +1,423 @@
+/*----------------------------------------------------------------------------
+* Copyright (c) Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+* C++ AMP algorithms library.
+*
+* This file contains the tracing hooks used to time the algorithms and the 
+* kernels, copies and synchronizations they issue.
+*
+* Tracing is opt-in. Define AMP_ALGORITHMS_ENABLE_TRACING for every 
+* translation unit that includes the library, then bracket the code of 
+* interest with start_tracing() and stop_tracing(). Without the define the 
+* hooks expand to nothing and recording functions see no events.
+*---------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <amp.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <ios>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace amp_algorithms
+{
+    //----------------------------------------------------------------------------
+    // trace events
+    //----------------------------------------------------------------------------
+
+    enum class trace_category : int
+    {
+        algorithm = 0,
+        kernel = 1,
+        copy = 2,
+        synchronize = 3
+    };
+
+    // One timed span. Times are in microseconds since start_tracing(). Kernel events record the compute 
+    // domain in extent and, for tiled kernels, the tile extent in tile. Copy events record the bytes moved.
+    struct trace_event
+    {
+        std::string name;
+        trace_category category;
+        double start_us;
+        double duration_us;
+        std::vector<int> extent;
+        std::vector<int> tile;
+        size_t bytes;
+        size_t thread_id;
+    };
+
+    typedef std::function<void(const trace_event&)> trace_sink;
+
+    namespace _details
+    {
+        typedef std::chrono::high_resolution_clock trace_clock;
+
+        // The recorder state is shared by all translation units. The members are static members of a class 
+        // template so that the header can define them. The flags are atomic so that every traced call can test 
+        // them without taking the mutex, which guards the rest; they are zero initialized, so false before any 
+        // dynamic initialization runs.
+
+        template <typename Dummy = void>
+        struct trace_recorder
+        {
+            static std::mutex mutex;
+            static std::atomic<bool> enabled;
+            static std::atomic<bool> synchronize_kernels;
+            static trace_clock::time_point origin;
+            static std::vector<trace_event> events;
+            static trace_sink sink;
+        };
+
+        template <typename Dummy>
+        std::mutex trace_recorder<Dummy>::mutex;
+
+        template <typename Dummy>
+        std::atomic<bool> trace_recorder<Dummy>::enabled;
+
+        template <typename Dummy>
+        std::atomic<bool> trace_recorder<Dummy>::synchronize_kernels;
+
+        template <typename Dummy>
+        trace_clock::time_point trace_recorder<Dummy>::origin;
+
+        template <typename Dummy>
+        std::vector<trace_event> trace_recorder<Dummy>::events;
+
+        template <typename Dummy>
+        trace_sink trace_recorder<Dummy>::sink;
+
+        // Records a span that ran from start to end. Its times are taken relative to the origin of the current 
+        // recording.
+        inline void record_trace_event(trace_event& event, const trace_clock::time_point start, const trace_clock::time_point end)
+        {
+            event.thread_id = std::hash<std::thread::id>()(std::this_thread::get_id());
+            event.duration_us = std::chrono::duration<double, std::micro>(end - start).count();
+            trace_sink sink;
+            {
+                std::lock_guard<std::mutex> lock(trace_recorder<>::mutex);
+                if (!trace_recorder<>::enabled.load())
+                {
+                    return;
+                }
+                event.start_us = std::chrono::duration<double, std::micro>(start - trace_recorder<>::origin).count();
+                if (!trace_recorder<>::sink)
+                {
+                    trace_recorder<>::events.push_back(event);
+                    return;
+                }
+                sink = trace_recorder<>::sink;
+            }
+            // The sink is called without the lock held so that it may itself run algorithms.
+            sink(event);
+        }
+
+        template <int Rank>
+        std::vector<int> extent_to_vector(const concurrency::extent<Rank>& ext)
+        {
+            std::vector<int> dims(Rank);
+            for (int i = 0; i < Rank; ++i)
+            {
+                dims[i] = ext[i];
+            }
+            return dims;
+        }
+
+        // Times the lifetime of the scope and records it when tracing is enabled. Kernel scopes wait for the 
+        // accelerator_view before closing if start_tracing() was asked to synchronize kernels, so that their 
+        // duration covers execution rather than submission.
+
+        class trace_scope
+        {
+        public:
+            trace_scope(const char* name, const trace_category category, const size_t bytes = 0) : 
+                m_active(is_enabled()), m_accl_view(nullptr)
+            {
+                if (m_active)
+                {
+                    m_event.name = name;
+                    m_event.category = category;
+                    m_event.bytes = bytes;
+                    m_start = trace_clock::now();
+                }
+            }
+
+            template <int Rank>
+            trace_scope(const concurrency::accelerator_view& accl_view, const concurrency::extent<Rank>& compute_domain, 
+                const std::vector<int>& tile, const char* kernel_name) : 
+                m_active(is_enabled()), m_accl_view(&accl_view)
+            {
+                if (m_active)
+                {
+                    m_event.name = kernel_name;
+                    m_event.category = trace_category::kernel;
+                    m_event.extent = extent_to_vector(compute_domain);
+                    m_event.tile = tile;
+                    m_event.bytes = 0;
+                    m_start = trace_clock::now();
+                }
+            }
+
+            ~trace_scope()
+            {
+                if (!m_active)
+                {
+                    return;
+                }
+                if ((m_accl_view != nullptr) && synchronize_kernels())
+                {
+                    try
+                    {
+                        m_accl_view->wait();
+                    }
+                    catch (...)
+                    {
+                        // The failure is reported to the caller by the next operation on the view.
+                    }
+                }
+                record_trace_event(m_event, m_start, trace_clock::now());
+            }
+
+        private:
+            trace_scope(const trace_scope&);
+            trace_scope& operator=(const trace_scope&);
+
+            static bool is_enabled()
+            {
+                return trace_recorder<>::enabled.load();
+            }
+
+            static bool synchronize_kernels()
+            {
+                return trace_recorder<>::synchronize_kernels.load();
+            }
+
+            bool m_active;
+            const concurrency::accelerator_view* m_accl_view;
+            trace_clock::time_point m_start;
+            trace_event m_event;
+        };
+
+        inline const char* trace_category_name(const trace_category category)
+        {
+            switch (category)
+            {
+            case trace_category::algorithm:
+                return "algorithm";
+            case trace_category::kernel:
+                return "kernel";
+            case trace_category::copy:
+                return "copy";
+            default:
+                return "synchronize";
+            }
+        }
+
+        inline void write_json_string(std::ostream& stream, const std::string& value)
+        {
+            stream << '"';
+            for (const char c : value)
+            {
+                switch (c)
+                {
+                case '"':
+                    stream << "\\\"";
+                    break;
+                case '\\':
+                    stream << "\\\\";
+                    break;
+                case '\n':
+                    stream << "\\n";
+                    break;
+                case '\t':
+                    stream << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) >= 0x20)
+                    {
+                        stream << c;
+                    }
+                }
+            }
+            stream << '"';
+        }
+
+        inline void write_json_array(std::ostream& stream, const std::vector<int>& values)
+        {
+            stream << '[';
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                stream << ((i == 0) ? "" : ",") << values[i];
+            }
+            stream << ']';
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    // start_tracing, stop_tracing
+    //----------------------------------------------------------------------------
+
+    // Discards any recorded events and starts recording. If synchronize_kernels is true every traced kernel 
+    // waits for its accelerator_view to drain, which measures kernel execution time at the cost of 
+    // serializing the host with the accelerator.
+    inline void start_tracing(const bool synchronize_kernels = false)
+    {
+        std::lock_guard<std::mutex> lock(_details::trace_recorder<>::mutex);
+        _details::trace_recorder<>::events.clear();
+        _details::trace_recorder<>::synchronize_kernels.store(synchronize_kernels);
+        _details::trace_recorder<>::origin = _details::trace_clock::now();
+        _details::trace_recorder<>::enabled.store(true);
+    }
+
+    inline void stop_tracing()
+    {
+        std::lock_guard<std::mutex> lock(_details::trace_recorder<>::mutex);
+        _details::trace_recorder<>::enabled.store(false);
+    }
+
+    inline bool is_tracing()
+    {
+        return _details::trace_recorder<>::enabled.load();
+    }
+
+    // Sends each event to sink as it completes instead of buffering it. Pass an empty sink to go back to 
+    // buffering. The sink may be called concurrently from several threads.
+    inline void set_trace_sink(const trace_sink& sink)
+    {
+        std::lock_guard<std::mutex> lock(_details::trace_recorder<>::mutex);
+        _details::trace_recorder<>::sink = sink;
+    }
+
+    // Events buffered since start_tracing(), in completion order. Enclosing spans complete after the spans 
+    // they contain.
+    inline std::vector<trace_event> get_trace_events()
+    {
+        std::lock_guard<std::mutex> lock(_details::trace_recorder<>::mutex);
+        return _details::trace_recorder<>::events;
+    }
+
+    //----------------------------------------------------------------------------
+    // write_chrome_trace
+    //----------------------------------------------------------------------------
+
+    // Writes events in the Chrome trace event format, which chrome://tracing and compatible viewers load. 
+    // Each event becomes a complete ("X") event; extents, tiles and byte counts go in its args.
+    inline void write_chrome_trace(std::ostream& stream, const std::vector<trace_event>& events)
+    {
+        const std::ios_base::fmtflags flags = stream.flags();
+        const std::streamsize precision = stream.precision();
+        stream << std::fixed;
+        stream.precision(3);
+        stream << "{\"traceEvents\":[";
+        for (size_t i = 0; i < events.size(); ++i)
+        {
+            const trace_event& event = events[i];
+            stream << ((i == 0) ? "\n" : ",\n") << "{\"name\":";
+            _details::write_json_string(stream, event.name);
+            stream << ",\"cat\":\"" << _details::trace_category_name(event.category) << "\",\"ph\":\"X\"";
+            stream << ",\"ts\":" << event.start_us << ",\"dur\":" << event.duration_us;
+            stream << ",\"pid\":0,\"tid\":" << static_cast<unsigned int>(event.thread_id) << ",\"args\":{";
+            stream << "\"bytes\":" << event.bytes;
+            if (!event.extent.empty())
+            {
+                stream << ",\"extent\":";
+                _details::write_json_array(stream, event.extent);
+            }
+            if (!event.tile.empty())
+            {
+                stream << ",\"tile\":";
+                _details::write_json_array(stream, event.tile);
+            }
+            stream << "}}";
+        }
+        stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        stream.flags(flags);
+        stream.precision(precision);
+    }
+
+    inline void write_chrome_trace(std::ostream& stream)
+    {
+        write_chrome_trace(stream, get_trace_events());
+    }
+}
+
+//----------------------------------------------------------------------------
+// Hooks
+//----------------------------------------------------------------------------
+//
+// AMP_ALGORITHMS_TRACE_ALGORITHM() opens a span named after the enclosing function that lasts until the end 
+// of the block. The kernel, copy and synchronize hooks are used by _details::parallel_for_each, traced_copy 
+// and traced_synchronize.
+
+#if defined(AMP_ALGORITHMS_ENABLE_TRACING)
+
+#define AMP_ALGORITHMS_TRACE_ALGORITHM() \
+    ::amp_algorithms::_details::trace_scope _amp_algorithms_trace_algorithm(__FUNCTION__, ::amp_algorithms::trace_category::algorithm)
+
+#define AMP_ALGORITHMS_TRACE_KERNEL(accl_view, compute_domain, tile, kernel_type) \
+    ::amp_algorithms::_details::trace_scope _amp_algorithms_trace_kernel(accl_view, compute_domain, tile, typeid(kernel_type).name())
+
+#define AMP_ALGORITHMS_TRACE_COPY(bytes) \
+    ::amp_algorithms::_details::trace_scope _amp_algorithms_trace_copy("copy", ::amp_algorithms::trace_category::copy, bytes)
+
+#define AMP_ALGORITHMS_TRACE_SYNCHRONIZE() \
+    ::amp_algorithms::_details::trace_scope _amp_algorithms_trace_synchronize("synchronize", ::amp_algorithms::trace_category::synchronize)
+
+#else
+
+#define AMP_ALGORITHMS_TRACE_ALGORITHM() ((void)0)
+#define AMP_ALGORITHMS_TRACE_KERNEL(accl_view, compute_domain, tile, kernel_type) ((void)0)
+#define AMP_ALGORITHMS_TRACE_COPY(bytes) ((void)0)
+#define AMP_ALGORITHMS_TRACE_SYNCHRONIZE() ((void)0)
+
+#endif
+
+namespace amp_algorithms
+{
+    namespace _details
+    {
+        // concurrency::copy() and array_view::synchronize() with copy and synchronize hooks.
+
+        template <typename T, int Rank, typename Destination>
+        void traced_copy(const concurrency::array_view<T, Rank>& source, Destination&& destination)
+        {
+            AMP_ALGORITHMS_TRACE_COPY(source.extent.size() * sizeof(T));
+            concurrency::copy(source, std::forward<Destination>(destination));
+        }
+
+        template <typename T, int Rank, typename Destination>
+        void traced_copy(const concurrency::array<T, Rank>& source, Destination&& destination)
+        {
+            AMP_ALGORITHMS_TRACE_COPY(source.extent.size() * sizeof(T));
+            concurrency::copy(source, std::forward<Destination>(destination));
+        }
+
+        template <typename T, int Rank>
+        void traced_synchronize(const concurrency::array_view<T, Rank>& view)
+        {
+            AMP_ALGORITHMS_TRACE_SYNCHRONIZE();
+            view.synchronize();
+        }
+    }
+}
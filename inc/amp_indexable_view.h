@@ -26,6 +26,31 @@ namespace amp_algorithms
 {
     using namespace concurrency;
 
+    namespace _details
+    {
+        // The dimension in which consecutive indices of a view address consecutive elements of its storage, or -1 
+        // if there is no such dimension. Views other than array and array_view declare it by specializing this 
+        // template.
+
+        template <typename view>
+        struct contiguous_dimension
+        {
+            static const int value = -1;
+        };
+
+        template <typename T, int N>
+        struct contiguous_dimension<concurrency::array_view<T, N>>
+        {
+            static const int value = N - 1;
+        };
+
+        template <typename T, int N>
+        struct contiguous_dimension<concurrency::array<T, N>>
+        {
+            static const int value = N - 1;
+        };
+    } // namespace _details
+
     // The type indexable_view_traits defines the traits of any type that
     // conforms to the indexable_view concept. An indexable view should:
     // a. Have a static member 'rank' of type int, which indicates the rank
@@ -47,7 +72,10 @@ namespace amp_algorithms
         static const int rank = view::rank;
         static const bool is_writable = std::is_convertible<typename decltype(std::declval<view>()[std::declval<concurrency::index<rank>>()]), value_type&>::value;
 
-        // TODO: Other traits such as whether the storage is dense in LSD or in which dimension is the storage contiguous
+        // The dimension in which the storage is contiguous, or -1. A view is contiguous when that is its least 
+        // significant dimension, so that neighboring threads of a row major kernel read neighboring elements.
+        static const int contiguous_dimension = _details::contiguous_dimension<view>::value;
+        static const bool is_contiguous = (contiguous_dimension == (rank - 1));
 
         static_assert(std::is_convertible<typename decltype(std::declval<view>().extent), const concurrency::extent<rank>&>::value, "Not a valid indexable_view. Should have a member 'extent'");
 
@@ -98,4 +126,234 @@ namespace amp_algorithms
         return functor_view<Functor, Rank>(ext, functor);
     }
 
+    namespace _details
+    {
+        // Conversions between an index and its row major linear position in an extent.
+
+        template <int N>
+        inline int flatten(const concurrency::index<N>& idx, const concurrency::extent<N>& ext) restrict(cpu, amp)
+        {
+            int linear_idx = idx[0];
+            for (int i = 1; i < N; ++i)
+            {
+                linear_idx = (linear_idx * ext[i]) + idx[i];
+            }
+            return linear_idx;
+        }
+
+        template <int N>
+        inline concurrency::index<N> unflatten(int linear_idx, const concurrency::extent<N>& ext) restrict(cpu, amp)
+        {
+            concurrency::index<N> result;
+            for (int i = N - 1; i >= 0; --i)
+            {
+                result[i] = linear_idx % ext[i];
+                linear_idx /= ext[i];
+            }
+            return result;
+        }
+
+        inline concurrency::index<1> unflatten(const int linear_idx, const concurrency::extent<1>&) restrict(cpu, amp)
+        {
+            return concurrency::index<1>(linear_idx);
+        }
+    } // namespace _details
+
+    //----------------------------------------------------------------------------
+    // View adaptors
+    //----------------------------------------------------------------------------
+    //
+    // Adaptors present an indexable view with a different shape or element order without copying it. They hold 
+    // the underlying view by value, so it must be capturable in a kernel, and return what its operator[] returns, 
+    // so writes through an adaptor of a writable view update the underlying data.
+
+    // Every stride[i]-th element of view in each dimension.
+    template <typename View>
+    class strided_view
+    {
+    public:
+        static const int rank = indexable_view_traits<View>::rank;
+        typedef typename indexable_view_traits<View>::value_type value_type;
+        typedef decltype(std::declval<const View&>()[std::declval<concurrency::index<rank>>()]) reference;
+
+        strided_view(const View& view, const concurrency::index<rank>& stride)
+            : _M_view(view), _M_stride(stride), _M_extent(view.extent)
+        {
+            for (int i = 0; i < rank; ++i)
+            {
+                if (stride[i] <= 0)
+                {
+                    throw concurrency::runtime_exception("The stride must be positive.", E_INVALIDARG);
+                }
+                _M_extent[i] = (_M_extent[i] + stride[i] - 1) / stride[i];
+            }
+        }
+
+        reference operator[](const concurrency::index<rank>& idx) const restrict(cpu, amp)
+        {
+            concurrency::index<rank> source_idx;
+            for (int i = 0; i < rank; ++i)
+            {
+                source_idx[i] = idx[i] * _M_stride[i];
+            }
+            return _M_view[source_idx];
+        }
+
+        __declspec(property(get=get_extent)) concurrency::extent<rank> extent;
+        concurrency::extent<rank> get_extent() const restrict(cpu, amp)
+        {
+            return _M_extent;
+        }
+
+    private:
+        View _M_view;
+        concurrency::index<rank> _M_stride;
+        concurrency::extent<rank> _M_extent;
+    };
+
+    // The elements of a rank 1 view in reverse order.
+    template <typename View>
+    class reversed_view
+    {
+    public:
+        static const int rank = 1;
+        typedef typename indexable_view_traits<View>::value_type value_type;
+        typedef decltype(std::declval<const View&>()[std::declval<concurrency::index<rank>>()]) reference;
+
+        static_assert(indexable_view_traits<View>::rank == 1, "Only views of rank 1 can be reversed");
+
+        explicit reversed_view(const View& view) : _M_view(view)
+        {
+        }
+
+        reference operator[](const concurrency::index<rank>& idx) const restrict(cpu, amp)
+        {
+            return _M_view[concurrency::index<1>(_M_view.extent[0] - 1 - idx[0])];
+        }
+
+        __declspec(property(get=get_extent)) concurrency::extent<rank> extent;
+        concurrency::extent<rank> get_extent() const restrict(cpu, amp)
+        {
+            return _M_view.extent;
+        }
+
+    private:
+        View _M_view;
+    };
+
+    // A rank 2 view with its dimensions swapped, element (i, j) is element (j, i) of view.
+    template <typename View>
+    class transposed_view
+    {
+    public:
+        static const int rank = 2;
+        typedef typename indexable_view_traits<View>::value_type value_type;
+        typedef decltype(std::declval<const View&>()[std::declval<concurrency::index<rank>>()]) reference;
+
+        static_assert(indexable_view_traits<View>::rank == 2, "Only views of rank 2 can be transposed");
+
+        explicit transposed_view(const View& view) : _M_view(view)
+        {
+        }
+
+        reference operator[](const concurrency::index<rank>& idx) const restrict(cpu, amp)
+        {
+            return _M_view[concurrency::index<2>(idx[1], idx[0])];
+        }
+
+        __declspec(property(get=get_extent)) concurrency::extent<rank> extent;
+        concurrency::extent<rank> get_extent() const restrict(cpu, amp)
+        {
+            return concurrency::extent<2>(_M_view.extent[1], _M_view.extent[0]);
+        }
+
+    private:
+        View _M_view;
+    };
+
+    // The elements of view in row major order, presented with a different extent of the same size.
+    template <typename View, int Rank>
+    class reshape_view
+    {
+    public:
+        static const int rank = Rank;
+        typedef typename indexable_view_traits<View>::value_type value_type;
+        typedef decltype(std::declval<const View&>()[std::declval<concurrency::index<indexable_view_traits<View>::rank>>()]) reference;
+
+        reshape_view(const View& view, const concurrency::extent<rank>& ext) : _M_view(view), _M_extent(ext)
+        {
+            if (ext.size() != view.extent.size())
+            {
+                throw concurrency::runtime_exception("The reshaped extent must have the same size as the view.", E_INVALIDARG);
+            }
+        }
+
+        reference operator[](const concurrency::index<rank>& idx) const restrict(cpu, amp)
+        {
+            return _M_view[_details::unflatten(_details::flatten(idx, _M_extent), _M_view.extent)];
+        }
+
+        __declspec(property(get=get_extent)) concurrency::extent<rank> extent;
+        concurrency::extent<rank> get_extent() const restrict(cpu, amp)
+        {
+            return _M_extent;
+        }
+
+    private:
+        View _M_view;
+        concurrency::extent<rank> _M_extent;
+    };
+
+    namespace _details
+    {
+        template <typename View>
+        struct contiguous_dimension<transposed_view<View>>
+        {
+            static const int value = (indexable_view_traits<View>::contiguous_dimension < 0) ? -1 : (1 - indexable_view_traits<View>::contiguous_dimension);
+        };
+
+        // Consecutive elements stay consecutive within a row of the underlying view.
+        template <typename View, int Rank>
+        struct contiguous_dimension<reshape_view<View, Rank>>
+        {
+            static const int value = indexable_view_traits<View>::is_contiguous ? (Rank - 1) : -1;
+        };
+    } // namespace _details
+
+    template <typename View>
+    strided_view<View> make_strided_view(const View& view, const concurrency::index<indexable_view_traits<View>::rank>& stride)
+    {
+        return strided_view<View>(view, stride);
+    }
+
+    // The same stride in every dimension.
+    template <typename View>
+    strided_view<View> make_strided_view(const View& view, const int stride)
+    {
+        concurrency::index<indexable_view_traits<View>::rank> strides;
+        for (int i = 0; i < indexable_view_traits<View>::rank; ++i)
+        {
+            strides[i] = stride;
+        }
+        return strided_view<View>(view, strides);
+    }
+
+    template <typename View>
+    reversed_view<View> make_reversed_view(const View& view)
+    {
+        return reversed_view<View>(view);
+    }
+
+    template <typename View>
+    transposed_view<View> make_transposed_view(const View& view)
+    {
+        return transposed_view<View>(view);
+    }
+
+    template <typename View, int Rank>
+    reshape_view<View, Rank> make_reshape_view(const View& view, const concurrency::extent<Rank>& ext)
+    {
+        return reshape_view<View, Rank>(view, ext);
+    }
+
 } // namespace amp_algorithms
@@ -302,7 +302,483 @@ namespace amp_stl_algorithms
     // TODO_NOT_IMPLEMENTED: cbegin and cend
 
     //----------------------------------------------------------------------------
-    // Zip iterator
+    // Lazy iterators
+    //
+    // counting_iterator, constant_iterator, transform_iterator, zip_iterator and 
+    // permutation_iterator compute their elements on demand instead of reading 
+    // them from an array_view. They are usable in restrict(amp) code and can be
+    // passed to the algorithms in place of an array_view_iterator, in which case
+    // the algorithm's kernel evaluates them directly and no buffer is allocated. 
+    // For example
+    //
+    // reduce(make_transform_iterator(counting_iterator<int>(0), f), ..., 0, plus<int>())
+    //
+    // computes f(0) + f(1) + ... in a single kernel.
+    //
+    // Except for a permutation_iterator over a writable iterator the elements are
+    // returned by value and cannot be assigned to. Algorithms that copy a range to
+    // or from the host, sort or reorder their input in place require array_view 
+    // iterators.
+    //----------------------------------------------------------------------------
+
+    template <typename T1, typename T2>
+    class pair;
+
+    namespace _details
+    {
+        // Implements the random access iterator operators of the lazy iterators in terms of three members
+        // of Derived: advance(delta), distance_to(other), which returns other - *this, and operator[](delta).
+
+        template <typename Derived, typename Value, typename Reference = Value>
+        class iterator_facade : public std::iterator<std::random_access_iterator_tag, Value, int, void, Reference>
+        {
+        public:
+            typedef int difference_type;
+            typedef Reference reference;
+
+            reference operator*() const restrict(cpu,amp)
+            {
+                return derived()[0];
+            }
+
+            // Prefix
+            Derived& operator++() restrict(cpu,amp)
+            {
+                derived().advance(1);
+                return derived();
+            }
+
+            // Postfix
+            Derived operator++(int) restrict(cpu,amp)
+            {
+                Derived temp = derived();
+                derived().advance(1);
+                return temp;
+            }
+
+            // Prefix
+            Derived& operator--() restrict(cpu,amp)
+            {
+                derived().advance(-1);
+                return derived();
+            }
+
+            // Postfix
+            Derived operator--(int) restrict(cpu,amp)
+            {
+                Derived temp = derived();
+                derived().advance(-1);
+                return temp;
+            }
+
+            Derived& operator+=(difference_type delta) restrict(cpu,amp)
+            {
+                derived().advance(delta);
+                return derived();
+            }
+
+            Derived& operator-=(difference_type delta) restrict(cpu,amp)
+            {
+                derived().advance(-delta);
+                return derived();
+            }
+
+            Derived operator+(difference_type delta) const restrict(cpu,amp)
+            {
+                Derived temp = derived();
+                temp.advance(delta);
+                return temp;
+            }
+
+            Derived operator-(difference_type delta) const restrict(cpu,amp)
+            {
+                return this->operator+(-delta);
+            }
+
+            difference_type operator-(const Derived& other) const restrict(cpu,amp)
+            {
+                return other.distance_to(derived());
+            }
+
+            friend Derived operator+(difference_type delta, const Derived& iter) restrict(cpu,amp)
+            {
+                return iter + delta;
+            }
+
+            bool operator==(const Derived& rhs) const restrict(cpu,amp)
+            {
+                return (derived().distance_to(rhs) == 0);
+            }
+
+            bool operator!=(const Derived& rhs) const restrict(cpu,amp)
+            {
+                return !(*this == rhs);
+            }
+
+            bool operator<(const Derived& rhs) const restrict(cpu,amp)
+            {
+                return (derived().distance_to(rhs) > 0);
+            }
+
+            bool operator>(const Derived& rhs) const restrict(cpu,amp)
+            {
+                return (derived().distance_to(rhs) < 0);
+            }
+
+            bool operator<=(const Derived& rhs) const restrict(cpu,amp)
+            {
+                return !(*this > rhs);
+            }
+
+            bool operator>=(const Derived& rhs) const restrict(cpu,amp)
+            {
+                return !(*this < rhs);
+            }
+
+        private:
+            Derived& derived() restrict(cpu,amp)
+            {
+                return static_cast<Derived&>(*this);
+            }
+
+            const Derived& derived() const restrict(cpu,amp)
+            {
+                return static_cast<const Derived&>(*this);
+            }
+        };
+
+        // The lazy iterators are the iterators derived from iterator_facade.
+
+        template <typename Iterator>
+        struct is_lazy_iterator
+        {
+        private:
+            template <typename Derived, typename Value, typename Reference>
+            static std::true_type test(const iterator_facade<Derived, Value, Reference>*);
+            static std::false_type test(...);
+
+            typedef decltype(test(static_cast<const Iterator*>(nullptr))) result_type;
+
+        public:
+            static const bool value = result_type::value;
+        };
+
+        // Presents a range of a lazy iterator as a rank 1 indexable view, so that algorithms can capture it 
+        // in a kernel in place of an array_view section.
+
+        template <typename Iterator>
+        class iterator_view
+        {
+        public:
+            static const int rank = 1;
+            typedef typename std::iterator_traits<Iterator>::value_type value_type;
+            typedef typename std::iterator_traits<Iterator>::reference reference;
+
+            iterator_view(const Iterator& first, int element_count) restrict(cpu,amp)
+                : m_first(first), m_extent(element_count)
+            {
+            }
+
+            reference operator[](const concurrency::index<1>& idx) const restrict(cpu,amp)
+            {
+                return m_first[idx[0]];
+            }
+
+            reference operator[](int idx) const restrict(cpu,amp)
+            {
+                return m_first[idx];
+            }
+
+            __declspec(property(get=get_extent)) concurrency::extent<1> extent;
+            concurrency::extent<1> get_extent() const restrict(cpu,amp)
+            {
+                return m_extent;
+            }
+
+            // There is no storage behind the view, so there is nothing to discard.
+            void discard_data() const
+            {
+            }
+
+        private:
+            Iterator m_first;
+            concurrency::extent<1> m_extent;
+        };
+    }
+
+    //----------------------------------------------------------------------------
+    // counting_iterator
+    //
+    // Iterates over the values value, value + 1, value + 2, ...
     //----------------------------------------------------------------------------
 
+    template <typename T>
+    class counting_iterator : public _details::iterator_facade<counting_iterator<T>, T>
+    {
+        friend class _details::iterator_facade<counting_iterator<T>, T>;
+
+    public:
+        counting_iterator() restrict(cpu,amp)
+            : m_value()
+        {
+        }
+
+        explicit counting_iterator(const T& value) restrict(cpu,amp)
+            : m_value(value)
+        {
+        }
+
+        T operator[](int delta) const restrict(cpu,amp)
+        {
+            return m_value + static_cast<T>(delta);
+        }
+
+    private:
+        void advance(int delta) restrict(cpu,amp)
+        {
+            m_value += static_cast<T>(delta);
+        }
+
+        int distance_to(const counting_iterator& other) const restrict(cpu,amp)
+        {
+            return static_cast<int>(other.m_value - m_value);
+        }
+
+        T m_value;
+    };
+
+    template <typename T>
+    counting_iterator<T> make_counting_iterator(const T& value) restrict(cpu,amp)
+    {
+        return counting_iterator<T>(value);
+    }
+
+    //----------------------------------------------------------------------------
+    // constant_iterator
+    //
+    // Iterates over the same value at every position.
+    //----------------------------------------------------------------------------
+
+    template <typename T>
+    class constant_iterator : public _details::iterator_facade<constant_iterator<T>, T>
+    {
+        friend class _details::iterator_facade<constant_iterator<T>, T>;
+
+    public:
+        constant_iterator() restrict(cpu,amp)
+            : m_value(), m_position(0)
+        {
+        }
+
+        explicit constant_iterator(const T& value, int position = 0) restrict(cpu,amp)
+            : m_value(value), m_position(position)
+        {
+        }
+
+        T operator[](int) const restrict(cpu,amp)
+        {
+            return m_value;
+        }
+
+    private:
+        void advance(int delta) restrict(cpu,amp)
+        {
+            m_position += delta;
+        }
+
+        int distance_to(const constant_iterator& other) const restrict(cpu,amp)
+        {
+            return other.m_position - m_position;
+        }
+
+        T m_value;
+        int m_position;
+    };
+
+    template <typename T>
+    constant_iterator<T> make_constant_iterator(const T& value, int position = 0) restrict(cpu,amp)
+    {
+        return constant_iterator<T>(value, position);
+    }
+
+    //----------------------------------------------------------------------------
+    // transform_iterator
+    //
+    // Iterates over func(*iter) for each position of an underlying iterator. The
+    // functor needs to be blittable and restrict(cpu, amp).
+    //----------------------------------------------------------------------------
+
+    namespace _details
+    {
+        template <typename Iterator, typename UnaryFunction>
+        struct transform_iterator_value
+        {
+            typedef typename std::remove_const<typename std::remove_reference<
+                typename std::result_of<UnaryFunction(typename std::iterator_traits<Iterator>::reference)>::type>::type>::type type;
+        };
+    }
+
+    template <typename Iterator, typename UnaryFunction>
+    class transform_iterator : public _details::iterator_facade<transform_iterator<Iterator, UnaryFunction>, 
+        typename _details::transform_iterator_value<Iterator, UnaryFunction>::type>
+    {
+        friend class _details::iterator_facade<transform_iterator<Iterator, UnaryFunction>, 
+            typename _details::transform_iterator_value<Iterator, UnaryFunction>::type>;
+
+    public:
+        typedef typename _details::transform_iterator_value<Iterator, UnaryFunction>::type value_type;
+
+        transform_iterator(const Iterator& iter, const UnaryFunction& func) restrict(cpu,amp)
+            : m_iter(iter), m_func(func)
+        {
+        }
+
+        value_type operator[](int delta) const restrict(cpu,amp)
+        {
+            return m_func(m_iter[delta]);
+        }
+
+        const Iterator& base() const restrict(cpu,amp)
+        {
+            return m_iter;
+        }
+
+    private:
+        void advance(int delta) restrict(cpu,amp)
+        {
+            m_iter += delta;
+        }
+
+        int distance_to(const transform_iterator& other) const restrict(cpu,amp)
+        {
+            return static_cast<int>(other.m_iter - m_iter);
+        }
+
+        Iterator m_iter;
+        UnaryFunction m_func;
+    };
+
+    template <typename Iterator, typename UnaryFunction>
+    transform_iterator<Iterator, UnaryFunction> make_transform_iterator(const Iterator& iter, const UnaryFunction& func) restrict(cpu,amp)
+    {
+        return transform_iterator<Iterator, UnaryFunction>(iter, func);
+    }
+
+    //----------------------------------------------------------------------------
+    // zip_iterator
+    //
+    // Iterates over two ranges in step. Its elements are amp_stl_algorithms::pair
+    // values holding copies of the corresponding elements of each range.
+    //----------------------------------------------------------------------------
+
+    namespace _details
+    {
+        template <typename Iterator1, typename Iterator2>
+        struct zip_iterator_value
+        {
+            typedef pair<typename std::remove_const<typename std::iterator_traits<Iterator1>::value_type>::type, 
+                typename std::remove_const<typename std::iterator_traits<Iterator2>::value_type>::type> type;
+        };
+    }
+
+    template <typename Iterator1, typename Iterator2>
+    class zip_iterator : public _details::iterator_facade<zip_iterator<Iterator1, Iterator2>, 
+        typename _details::zip_iterator_value<Iterator1, Iterator2>::type>
+    {
+        friend class _details::iterator_facade<zip_iterator<Iterator1, Iterator2>, 
+            typename _details::zip_iterator_value<Iterator1, Iterator2>::type>;
+
+    public:
+        typedef typename _details::zip_iterator_value<Iterator1, Iterator2>::type value_type;
+
+        zip_iterator(const Iterator1& iter1, const Iterator2& iter2) restrict(cpu,amp)
+            : m_iter1(iter1), m_iter2(iter2)
+        {
+        }
+
+        value_type operator[](int delta) const restrict(cpu,amp)
+        {
+            return value_type(m_iter1[delta], m_iter2[delta]);
+        }
+
+        const Iterator1& first() const restrict(cpu,amp)
+        {
+            return m_iter1;
+        }
+
+        const Iterator2& second() const restrict(cpu,amp)
+        {
+            return m_iter2;
+        }
+
+    private:
+        void advance(int delta) restrict(cpu,amp)
+        {
+            m_iter1 += delta;
+            m_iter2 += delta;
+        }
+
+        int distance_to(const zip_iterator& other) const restrict(cpu,amp)
+        {
+            return static_cast<int>(other.m_iter1 - m_iter1);
+        }
+
+        Iterator1 m_iter1;
+        Iterator2 m_iter2;
+    };
+
+    template <typename Iterator1, typename Iterator2>
+    zip_iterator<Iterator1, Iterator2> make_zip_iterator(const Iterator1& iter1, const Iterator2& iter2) restrict(cpu,amp)
+    {
+        return zip_iterator<Iterator1, Iterator2>(iter1, iter2);
+    }
+
+    //----------------------------------------------------------------------------
+    // permutation_iterator
+    //
+    // Iterates over elements[indices[0]], elements[indices[1]], ... It is writable
+    // if the element iterator is, so it can be used both to gather and to scatter.
+    //----------------------------------------------------------------------------
+
+    template <typename ElementIterator, typename IndexIterator>
+    class permutation_iterator : public _details::iterator_facade<permutation_iterator<ElementIterator, IndexIterator>, 
+        typename std::iterator_traits<ElementIterator>::value_type, typename std::iterator_traits<ElementIterator>::reference>
+    {
+        friend class _details::iterator_facade<permutation_iterator<ElementIterator, IndexIterator>, 
+            typename std::iterator_traits<ElementIterator>::value_type, typename std::iterator_traits<ElementIterator>::reference>;
+
+    public:
+        typedef typename std::iterator_traits<ElementIterator>::reference reference;
+
+        permutation_iterator(const ElementIterator& elements, const IndexIterator& indices) restrict(cpu,amp)
+            : m_elements(elements), m_indices(indices)
+        {
+        }
+
+        reference operator[](int delta) const restrict(cpu,amp)
+        {
+            return m_elements[static_cast<int>(m_indices[delta])];
+        }
+
+    private:
+        void advance(int delta) restrict(cpu,amp)
+        {
+            m_indices += delta;
+        }
+
+        int distance_to(const permutation_iterator& other) const restrict(cpu,amp)
+        {
+            return static_cast<int>(other.m_indices - m_indices);
+        }
+
+        ElementIterator m_elements;
+        IndexIterator m_indices;
+    };
+
+    template <typename ElementIterator, typename IndexIterator>
+    permutation_iterator<ElementIterator, IndexIterator> make_permutation_iterator(const ElementIterator& elements, const IndexIterator& indices) restrict(cpu,amp)
+    {
+        return permutation_iterator<ElementIterator, IndexIterator>(elements, indices);
+    }
+
 } // amp_stl_algorithms
\ No newline at end of file
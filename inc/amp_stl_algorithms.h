@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <memory>
 #include <utility>
 #include <xx_amp_algorithms_impl.h>
 #include <xx_amp_algorithms_impl_inl.h>
@@ -145,6 +146,75 @@ namespace amp_stl_algorithms
         return pair<T1, T2>(val1, val2); 
     }
 
+    //----------------------------------------------------------------------------
+    // execution policies
+    //----------------------------------------------------------------------------
+
+    namespace execution
+    {
+        // Modelled on the C++17 execution policies. Passing a policy as the first argument of an algorithm 
+        // selects the accelerator_view that runs its kernels and holds its temporaries:
+        //
+        //  seq         runs on the WARP accelerator, a host path that does not need a GPU.
+        //  par         lets the runtime pick the accelerator_view, as the overloads without a policy do.
+        //  par_unseq   the same as par, every algorithm here is already unsequenced within its kernels.
+        //  device(av)  runs on av, so that independent pipelines can use separate accelerator_views.
+        //
+        // Nested algorithm calls made by an algorithm use the same accelerator_view.
+
+        enum class policy_kind
+        {
+            sequenced,
+            parallel,
+            parallel_unsequenced,
+            device
+        };
+
+        class execution_policy
+        {
+        public:
+            explicit execution_policy(policy_kind kind) : m_kind(kind)
+            {
+            }
+
+            explicit execution_policy(const concurrency::accelerator_view& accl_view) : 
+                m_kind(policy_kind::device), m_accl_view(std::make_shared<const concurrency::accelerator_view>(accl_view))
+            {
+            }
+
+            policy_kind kind() const { return m_kind; }
+
+            // False if the runtime chooses the accelerator_view.
+            bool is_pinned() const { return (m_kind == policy_kind::sequenced) || (m_kind == policy_kind::device); }
+
+            concurrency::accelerator_view accl_view() const
+            {
+                switch (m_kind)
+                {
+                case policy_kind::sequenced:
+                    return concurrency::accelerator(concurrency::accelerator::direct3d_warp).default_view;
+                case policy_kind::device:
+                    return *m_accl_view;
+                default:
+                    return amp_algorithms::_details::auto_select_target();
+                }
+            }
+
+        private:
+            policy_kind m_kind;
+            std::shared_ptr<const concurrency::accelerator_view> m_accl_view;
+        };
+
+        const execution_policy seq(policy_kind::sequenced);
+        const execution_policy par(policy_kind::parallel);
+        const execution_policy par_unseq(policy_kind::parallel_unsequenced);
+
+        inline execution_policy device(const concurrency::accelerator_view& accl_view)
+        {
+            return execution_policy(accl_view);
+        }
+    }
+
     //----------------------------------------------------------------------------
     // adjacent_difference
     //----------------------------------------------------------------------------
@@ -196,6 +266,16 @@ namespace amp_stl_algorithms
         RandomAccessIterator dest,
         UnaryPredicate p);
 
+    // Asynchronous copy_if() that writes the number of elements copied to count_view[0] on the accelerator 
+    // instead of returning an iterator. The destination must have room for last - first elements. The returned 
+    // completion_future becomes ready once the copy and the count have completed, see amp_algorithms::fill_async().
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator, typename UnaryPredicate>
+    concurrency::completion_future copy_if_async(ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last,
+        RandomAccessIterator dest,
+        UnaryPredicate p,
+        const concurrency::array_view<int>& count_view);
+
     template<typename ConstRandomAccessIterator, typename Size, typename RandomAccessIterator>
     RandomAccessIterator copy_n(ConstRandomAccessIterator first, Size count, RandomAccessIterator result);
 
@@ -217,6 +297,11 @@ namespace amp_stl_algorithms
     typename std::iterator_traits<ConstRandomAccessIterator>::difference_type
         count_if( ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryPredicate p ); 
 
+    // Asynchronous count_if() that writes the count to count_view[0] on the accelerator.
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    concurrency::completion_future count_if_async(ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryPredicate p, 
+        const concurrency::array_view<int>& count_view);
+
     //----------------------------------------------------------------------------
     // equal, equal_range
     //----------------------------------------------------------------------------
@@ -330,12 +415,8 @@ namespace amp_stl_algorithms
 
     template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2>
     bool includes(ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
-        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2)
-    {
-        return includes(first1, last1, first2, last2, amp_algorithms::equal_to());
-    }
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2);
 
-    // TODO_NOT_IMPLEMENTED: includes
     template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename Compare>
     bool includes( ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
         ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, 
@@ -496,12 +577,11 @@ namespace amp_stl_algorithms
     template<typename ConstRandomAccessIterator, typename Compare>
     ConstRandomAccessIterator max_element(ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp); 
 
-    // TODO_NOT_IMPLEMENTED: minmax_element
+    // Like std::minmax_element returns the first smallest and the last largest element.
     template<typename ConstRandomAccessIterator> 
     std::pair<ConstRandomAccessIterator,ConstRandomAccessIterator> 
         minmax_element( ConstRandomAccessIterator first, ConstRandomAccessIterator last ); 
 
-    // NOT IMPLEMENTED
     template<typename ConstRandomAccessIterator, typename Compare>
     std::pair<ConstRandomAccessIterator,ConstRandomAccessIterator> 
         minmax_element( ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp ); 
@@ -559,19 +639,16 @@ namespace amp_stl_algorithms
     // partition, stable_partition, partition_point, is_partitioned
     //----------------------------------------------------------------------------
 
-    // TODO_NOT_IMPLEMENTED: is_partitioned
     template<typename ConstRandomAccessIterator, typename UnaryPredicate>
     bool is_partitioned( ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryPredicate p );
 
-    // TODO_NOT_IMPLEMENTED: partition
+    // partition is implemented as stable_partition, so the relative order of elements is always preserved.
     template<typename RandomAccessIterator, typename UnaryPredicate>
-    RandomAccessIterator partition( RandomAccessIterator first, RandomAccessIterator last, UnaryPredicate comp);
+    RandomAccessIterator partition( RandomAccessIterator first, RandomAccessIterator last, UnaryPredicate p );
 
-    // TODO_NOT_IMPLEMENTED: stable_partition
     template<typename RandomAccessIterator, typename UnaryPredicate>
     RandomAccessIterator stable_partition( RandomAccessIterator first, RandomAccessIterator last, UnaryPredicate p );
 
-    // TODO_NOT_IMPLEMENTED: partition_point
     template<typename ConstRandomAccessIterator, typename UnaryPredicate>
     ConstRandomAccessIterator partition_point( ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryPredicate p);
 
@@ -587,6 +664,36 @@ namespace amp_stl_algorithms
     template<typename ConstRandomAccessIterator, typename T, typename BinaryOperation>
     T reduce( ConstRandomAccessIterator first, ConstRandomAccessIterator last, T init, BinaryOperation op ); 
 
+    // non-standard: Reduces each run of consecutive equal keys to a single key and the reduction of its values. 
+    // Returns the number of unique keys written to the destination ranges.
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2>
+    int reduce_by_key( ConstRandomAccessIterator1 keys_first,
+        ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first,
+        RandomAccessIterator1 keys_dest_first,
+        RandomAccessIterator2 values_dest_first );
+
+    // non-standard
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryOperation>
+    int reduce_by_key( ConstRandomAccessIterator1 keys_first,
+        ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first,
+        RandomAccessIterator1 keys_dest_first,
+        RandomAccessIterator2 values_dest_first,
+        BinaryOperation op );
+
+    // non-standard
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryPredicate, typename BinaryOperation>
+    int reduce_by_key( ConstRandomAccessIterator1 keys_first,
+        ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first,
+        RandomAccessIterator1 keys_dest_first,
+        RandomAccessIterator2 values_dest_first,
+        BinaryPredicate p,
+        BinaryOperation op );
+
     //----------------------------------------------------------------------------
     // remove, remove_if, remove_copy, remove_copy_if
     //----------------------------------------------------------------------------
@@ -714,7 +821,6 @@ namespace amp_stl_algorithms
     // set_difference, set_intersection, set_symetric_distance, set_union
     //----------------------------------------------------------------------------
 
-    // TODO_NOT_IMPLEMENTED: set_difference
     template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
     RandomAccessIterator set_difference( ConstRandomAccessIterator1 first1, 
         ConstRandomAccessIterator1 last1,
@@ -722,7 +828,6 @@ namespace amp_stl_algorithms
         ConstRandomAccessIterator2 last2,
         RandomAccessIterator d_first ); 
 
-    // NOT IMPLEMENTED
     template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
     RandomAccessIterator set_difference( ConstRandomAccessIterator1 first1, 
         ConstRandomAccessIterator1 last1,
@@ -731,7 +836,6 @@ namespace amp_stl_algorithms
         RandomAccessIterator d_first, 
         Compare comp ); 
 
-    // TODO_NOT_IMPLEMENTED: set_intersection
     template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
     RandomAccessIterator set_intersection( ConstRandomAccessIterator1 first1, 
         ConstRandomAccessIterator1 last1,
@@ -739,7 +843,6 @@ namespace amp_stl_algorithms
         ConstRandomAccessIterator2 last2,
         RandomAccessIterator d_first ); 
 
-    // NOT IMPLEMENTED
     template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
     RandomAccessIterator set_intersection( ConstRandomAccessIterator1 first1, 
         ConstRandomAccessIterator1 last1,
@@ -748,7 +851,6 @@ namespace amp_stl_algorithms
         RandomAccessIterator d_first, 
         Compare comp ); 
 
-    // TODO_NOT_IMPLEMENTED: set_symmetric_difference
     template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
     RandomAccessIterator set_symmetric_difference( ConstRandomAccessIterator1 first1, 
         ConstRandomAccessIterator1 last1,
@@ -756,7 +858,6 @@ namespace amp_stl_algorithms
         ConstRandomAccessIterator2 last2,
         RandomAccessIterator d_first ); 
 
-    // NOT IMPLEMENTED
     template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
     RandomAccessIterator set_symmetric_difference( ConstRandomAccessIterator1 first1, 
         ConstRandomAccessIterator1 last1,
@@ -765,7 +866,6 @@ namespace amp_stl_algorithms
         RandomAccessIterator d_first, 
         Compare comp); 
 
-    // TODO_NOT_IMPLEMENTED: set_union
     template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
     RandomAccessIterator set_union( ConstRandomAccessIterator1 first1, 
         ConstRandomAccessIterator1 last1,
@@ -773,7 +873,6 @@ namespace amp_stl_algorithms
         ConstRandomAccessIterator2 last2,
         RandomAccessIterator d_first ); 
 
-    // NOT IMPLEMENTED
     template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
     RandomAccessIterator set_union( ConstRandomAccessIterator1 first1, 
         ConstRandomAccessIterator1 last1,
@@ -903,25 +1002,367 @@ namespace amp_stl_algorithms
         BinaryFunction func);
 
     //----------------------------------------------------------------------------
-    // unique, unique_copy
+    // unique, unique_copy, unique_by_key, unique_by_key_copy
     //----------------------------------------------------------------------------
 
-    // TODO_NOT_IMPLEMENTED: unique
-    template<typename ConstRandomAccessIterator>
-    ConstRandomAccessIterator unique( ConstRandomAccessIterator first, ConstRandomAccessIterator last);
+    // The BinaryPredicate must be an equivalence relation. Each element is compared with its predecessor
+    // rather than the first element of its group.
 
-    // NOT IMPLEMENTED 
-    template<typename ConstRandomAccessIterator, typename BinaryPredicate>
-    ConstRandomAccessIterator unique( ConstRandomAccessIterator first, ConstRandomAccessIterator last, BinaryPredicate comp);
+    template<typename RandomAccessIterator>
+    RandomAccessIterator unique( RandomAccessIterator first, RandomAccessIterator last);
+
+    template<typename RandomAccessIterator, typename BinaryPredicate>
+    RandomAccessIterator unique( RandomAccessIterator first, RandomAccessIterator last, BinaryPredicate p);
 
-    // TODO_NOT_IMPLEMENTED: unique_copy
     template<typename ConstRandomAccessIterator,typename RandomAccessIterator>
-    ConstRandomAccessIterator unique_copy( ConstRandomAccessIterator first, ConstRandomAccessIterator last, RandomAccessIterator d_first ); 
+    RandomAccessIterator unique_copy( ConstRandomAccessIterator first, ConstRandomAccessIterator last, RandomAccessIterator d_first ); 
 
-    // NOT IMPLEMENTED 
     template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename BinaryPredicate>
-    ConstRandomAccessIterator unique_copy( ConstRandomAccessIterator first, 
+    RandomAccessIterator unique_copy( ConstRandomAccessIterator first, 
         ConstRandomAccessIterator last, 
         RandomAccessIterator d_first, 
         BinaryPredicate p); 
+
+    // non-standard, removes all but the first key of each group of equal keys and the value at the same position
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key( RandomAccessIterator1 keys_first,
+        RandomAccessIterator1 keys_last,
+        RandomAccessIterator2 values_first );
+
+    // non-standard
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryPredicate>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key( RandomAccessIterator1 keys_first,
+        RandomAccessIterator1 keys_last,
+        RandomAccessIterator2 values_first,
+        BinaryPredicate p );
+
+    // non-standard
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key_copy( ConstRandomAccessIterator1 keys_first,
+        ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first,
+        RandomAccessIterator1 keys_dest_first,
+        RandomAccessIterator2 values_dest_first );
+
+    // non-standard
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryPredicate>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key_copy( ConstRandomAccessIterator1 keys_first,
+        ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first,
+        RandomAccessIterator1 keys_dest_first,
+        RandomAccessIterator2 values_dest_first,
+        BinaryPredicate p );
+
+    //----------------------------------------------------------------------------
+    // execution policy overloads
+    //----------------------------------------------------------------------------
+
+    // Run the algorithm on the accelerator_view selected by the policy, see execution_policy.
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator>
+    RandomAccessIterator adjacent_difference(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, RandomAccessIterator dest_first);
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename BinaryOperation>
+    RandomAccessIterator adjacent_difference(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first, BinaryOperation op);
+
+    template<typename ConstRandomAccessIterator,  typename UnaryPredicate>
+    bool all_of(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p);
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    bool any_of(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p);
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    bool none_of(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p);
+
+    template<typename ConstRandomAccessIterator,  typename UnaryPredicate, typename OutputIterator>
+    void any_of(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        UnaryPredicate p, OutputIterator dest);
+
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator>
+    RandomAccessIterator copy(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, RandomAccessIterator dest_beg);
+
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator copy_if(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest, UnaryPredicate p);
+
+    template<typename ConstRandomAccessIterator, typename Size, typename RandomAccessIterator>
+    RandomAccessIterator copy_n(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        Size count, RandomAccessIterator result);
+
+    template<typename ConstRandomAccessIterator, typename T>
+    typename std::iterator_traits<ConstRandomAccessIterator>::difference_type count(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, const T &value);
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    typename std::iterator_traits<ConstRandomAccessIterator>::difference_type count_if(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2>
+    bool equal(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1,
+        ConstRandomAccessIterator1 last1, ConstRandomAccessIterator2 first2);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename BinaryPredicate>
+    bool equal(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, BinaryPredicate p);
+
+    template<typename RandomAccessIterator, typename T>
+    void fill(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last, const T& value);
+
+    template<typename RandomAccessIterator, typename Size, typename T>
+    RandomAccessIterator fill_n(const execution::execution_policy& policy, RandomAccessIterator first, Size count, const T& value);
+
+    template<typename ConstRandomAccessIterator, typename T>
+    ConstRandomAccessIterator find(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, const T& value);
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    ConstRandomAccessIterator find_if(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p);
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    ConstRandomAccessIterator find_if_not(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p);
+
+    template<typename ConstRandomAccessIterator>
+    ConstRandomAccessIterator adjacent_find(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last);
+
+    template<typename ConstRandomAccessIterator, typename Predicate>
+    ConstRandomAccessIterator adjacent_find(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, Predicate p);
+
+    template<typename ConstRandomAccessIterator, typename UnaryFunction>
+    UnaryFunction for_each(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryFunction f);
+
+    template<typename ConstRandomAccessIterator, typename UnaryFunction>
+    void for_each_no_return(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryFunction f);
+
+    template<typename RandomAccessIterator, typename Generator>
+    void generate(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last, Generator g);
+
+    template<typename RandomAccessIterator, typename Size, typename Generator>
+    RandomAccessIterator generate_n(const execution::execution_policy& policy, RandomAccessIterator first, Size count, Generator g);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2>
+    bool includes(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename Compare>
+    bool includes(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, Compare comp);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename T>
+    T inner_product(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, const T value);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename T,
+        typename BinaryOperation1, typename BinaryOperation2>
+    T inner_product(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, const T value, const BinaryOperation1& binary_op1, const BinaryOperation2& binary_op2);
+
+    template<typename RandomAccessIterator, typename T>
+    void iota(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last, T value);
+
+    template<typename ConstRandomAccessIterator>
+    ConstRandomAccessIterator min_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last);
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    ConstRandomAccessIterator min_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, Compare comp);
+
+    template<typename ConstRandomAccessIterator>
+    ConstRandomAccessIterator max_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last);
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    ConstRandomAccessIterator max_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, Compare comp);
+
+    template<typename ConstRandomAccessIterator>
+    std::pair<ConstRandomAccessIterator,ConstRandomAccessIterator> minmax_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last);
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    std::pair<ConstRandomAccessIterator,ConstRandomAccessIterator> minmax_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, Compare comp);
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    bool is_partitioned(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p);
+
+    template<typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator partition(const execution::execution_policy& policy, RandomAccessIterator first,
+        RandomAccessIterator last, UnaryPredicate p);
+
+    template<typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator stable_partition(const execution::execution_policy& policy, RandomAccessIterator first,
+        RandomAccessIterator last, UnaryPredicate p);
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    ConstRandomAccessIterator partition_point(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p);
+
+    template<typename ConstRandomAccessIterator, typename T>
+    T reduce(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last, T init);
+
+    template<typename ConstRandomAccessIterator, typename T, typename BinaryOperation>
+    T reduce(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        T init, BinaryOperation op);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2>
+    int reduce_by_key(const execution::execution_policy& policy, ConstRandomAccessIterator1 keys_first, ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first, RandomAccessIterator1 keys_dest_first, RandomAccessIterator2 values_dest_first);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryOperation>
+    int reduce_by_key(const execution::execution_policy& policy, ConstRandomAccessIterator1 keys_first, ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first, RandomAccessIterator1 keys_dest_first, RandomAccessIterator2 values_dest_first, BinaryOperation op);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryPredicate, typename BinaryOperation>
+    int reduce_by_key(const execution::execution_policy& policy, ConstRandomAccessIterator1 keys_first, ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first, RandomAccessIterator1 keys_dest_first, RandomAccessIterator2 values_dest_first, BinaryPredicate p, BinaryOperation op);
+
+    template<typename RandomAccessIterator, typename T>
+    RandomAccessIterator remove(const execution::execution_policy& policy, RandomAccessIterator first,
+        RandomAccessIterator last, const T& value);
+
+    template<typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator remove_if(const execution::execution_policy& policy, RandomAccessIterator first,
+        RandomAccessIterator last, UnaryPredicate p);
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename T>
+    RandomAccessIterator remove_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first, const T& value);
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator remove_copy_if(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first, UnaryPredicate p);
+
+    template<typename RandomAccessIterator, typename T>
+    void replace(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last,
+        const T& old_value, const T& new_value);
+
+    template<typename RandomAccessIterator, typename UnaryPredicate, typename T>
+    void replace_if(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last,
+        UnaryPredicate p, const T& new_value);
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename T>
+    RandomAccessIterator replace_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first, const T& old_value, const T& new_value);
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryPredicate, typename T>
+    RandomAccessIterator replace_copy_if(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first, UnaryPredicate p, const T& new_value);
+
+    template<typename RandomAccessIterator>
+    void reverse(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last);
+
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator>
+    RandomAccessIterator reverse_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, RandomAccessIterator dest_first);
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator>
+    RandomAccessIterator rotate_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator middle,
+        ConstRandomAccessIterator last, RandomAccessIterator dest_first);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
+    RandomAccessIterator set_difference(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_difference(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first, Compare comp);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
+    RandomAccessIterator set_intersection(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_intersection(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first, Compare comp);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
+    RandomAccessIterator set_symmetric_difference(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_symmetric_difference(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first, Compare comp);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
+    RandomAccessIterator set_union(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_union(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first, Compare comp);
+
+    template<typename ConstRandomAccessIterator>
+    bool is_sorted(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last);
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    bool is_sorted(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp);
+
+    template<typename ConstRandomAccessIterator>
+    ConstRandomAccessIterator is_sorted_until(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last);
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    ConstRandomAccessIterator is_sorted_until(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, Compare comp);
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+    RandomAccessIterator2 swap_ranges(const execution::execution_policy& policy, RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+        RandomAccessIterator2 first2);
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryFunction>
+    RandomAccessIterator transform(const execution::execution_policy& policy, ConstRandomAccessIterator first1, ConstRandomAccessIterator last1,
+        RandomAccessIterator result, UnaryFunction func);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename BinaryFunction>
+    RandomAccessIterator transform(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, RandomAccessIterator dest_first, BinaryFunction func);
+
+    template<typename RandomAccessIterator>
+    RandomAccessIterator unique(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last);
+
+    template<typename RandomAccessIterator, typename BinaryPredicate>
+    RandomAccessIterator unique(const execution::execution_policy& policy, RandomAccessIterator first,
+        RandomAccessIterator last, BinaryPredicate p);
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator>
+    RandomAccessIterator unique_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, RandomAccessIterator d_first);
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename BinaryPredicate>
+    RandomAccessIterator unique_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator d_first, BinaryPredicate p);
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key(const execution::execution_policy& policy, RandomAccessIterator1 keys_first,
+        RandomAccessIterator1 keys_last, RandomAccessIterator2 values_first);
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryPredicate>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key(const execution::execution_policy& policy, RandomAccessIterator1 keys_first, RandomAccessIterator1 keys_last,
+        RandomAccessIterator2 values_first, BinaryPredicate p);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key_copy(const execution::execution_policy& policy, ConstRandomAccessIterator1 keys_first, ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first, RandomAccessIterator1 keys_dest_first, RandomAccessIterator2 values_dest_first);
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryPredicate>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key_copy(const execution::execution_policy& policy, ConstRandomAccessIterator1 keys_first, ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first, RandomAccessIterator1 keys_dest_first, RandomAccessIterator2 values_dest_first, BinaryPredicate p);
 }// namespace amp_stl_algorithms
@@ -22,11 +22,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <amp.h>
 #include <assert.h>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include <xx_amp_algorithms_impl_inl.h>
+#include <amp_algorithms_trace.h>
 #include <amp_indexable_view.h>
 
 namespace amp_algorithms
@@ -66,6 +72,7 @@ namespace amp_algorithms
         template <int _Rank, typename _Kernel_type>
         void parallel_for_each(const concurrency::accelerator_view &_Accl_view, const concurrency::extent<_Rank>& _Compute_domain, const _Kernel_type &_Kernel)
         {
+            AMP_ALGORITHMS_TRACE_KERNEL(_Accl_view, _Compute_domain, std::vector<int>(), _Kernel_type);
 #if _MSC_VER < 1800
             _Host_Scheduling_info _SchedulingInfo = { NULL };
             if (_Accl_view != _details::auto_select_target()) 
@@ -82,6 +89,7 @@ namespace amp_algorithms
         template <int _Dim0, int _Dim1, int _Dim2, typename _Kernel_type>
         void parallel_for_each(const concurrency::accelerator_view &_Accl_view, const concurrency::tiled_extent<_Dim0, _Dim1, _Dim2>& _Compute_domain, const _Kernel_type& _Kernel)
         {
+            AMP_ALGORITHMS_TRACE_KERNEL(_Accl_view, _Compute_domain, (std::vector<int>{ _Dim0, _Dim1, _Dim2 }), _Kernel_type);
 #if _MSC_VER < 1800
             _Host_Scheduling_info _SchedulingInfo = { NULL };
             if (_Accl_view != _details::auto_select_target()) 
@@ -98,6 +106,7 @@ namespace amp_algorithms
         template <int _Dim0, int _Dim1, typename _Kernel_type>
         void parallel_for_each(const concurrency::accelerator_view &_Accl_view, const concurrency::tiled_extent<_Dim0, _Dim1>& _Compute_domain, const _Kernel_type& _Kernel)
         {
+            AMP_ALGORITHMS_TRACE_KERNEL(_Accl_view, _Compute_domain, (std::vector<int>{ _Dim0, _Dim1 }), _Kernel_type);
 #if _MSC_VER < 1800
             _Host_Scheduling_info _SchedulingInfo = { NULL };
             if (_Accl_view != _details::auto_select_target()) 
@@ -114,6 +123,7 @@ namespace amp_algorithms
         template <int _Dim0, typename _Kernel_type>
         void parallel_for_each(const concurrency::accelerator_view &_Accl_view, const concurrency::tiled_extent<_Dim0>& _Compute_domain, const _Kernel_type& _Kernel)
         {
+            AMP_ALGORITHMS_TRACE_KERNEL(_Accl_view, _Compute_domain, (std::vector<int>{ _Dim0 }), _Kernel_type);
 #if _MSC_VER < 1800
             _Host_Scheduling_info _SchedulingInfo = { NULL };
             if (_Accl_view != _details::auto_select_target()) 
@@ -127,6 +137,317 @@ namespace amp_algorithms
 #endif
         }
 
+        //----------------------------------------------------------------------------
+        // Element-wise kernels
+        //----------------------------------------------------------------------------
+        //
+        // for_each_index() calls func(i) for every i in [0, element_count) from a bounded grid of tiles, so that 
+        // element-wise algorithms over large inputs are limited by memory bandwidth rather than by scheduling a 
+        // thread per element. Each pass of the grid gives every thread items_per_thread elements spaced by the 
+        // number of threads, so neighboring threads still access neighboring elements, and the grid strides 
+        // over the input until it is exhausted. Small inputs launch only the tiles they need.
+
+        static const int element_wise_tile_size = 256;
+        static const int element_wise_items_per_thread = 4;
+        static const int element_wise_max_tiles = 2048;
+
+        template <int tile_size, int items_per_thread, int max_tiles, typename IndexFunction>
+        void for_each_index(const concurrency::accelerator_view& accl_view, const int element_count, const IndexFunction& func)
+        {
+            if (element_count <= 0)
+            {
+                return;
+            }
+            const int elements_per_tile = tile_size * items_per_thread;
+            const int tile_count = std::min((element_count + elements_per_tile - 1) / elements_per_tile, max_tiles);
+            const int thread_count = tile_count * tile_size;
+
+            _details::parallel_for_each(accl_view, concurrency::extent<1>(thread_count).tile<tile_size>(), 
+                [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                for (int first = tidx.global[0]; first < element_count; first += (thread_count * items_per_thread))
+                {
+                    for (int i = 0; i < items_per_thread; ++i)
+                    {
+                        const int idx = first + (i * thread_count);
+                        if (idx < element_count)
+                        {
+                            func(idx);
+                        }
+                    }
+                }
+            });
+        }
+
+        template <typename IndexFunction>
+        void for_each_index(const concurrency::accelerator_view& accl_view, const int element_count, const IndexFunction& func)
+        {
+            for_each_index<element_wise_tile_size, element_wise_items_per_thread, element_wise_max_tiles>(accl_view, element_count, func);
+        }
+
+        // Calls func(idx) for every index of ext.
+        template <int Rank, typename IndexFunction>
+        void for_each_index(const concurrency::accelerator_view& accl_view, const concurrency::extent<Rank>& ext, const IndexFunction& func)
+        {
+            for_each_index(accl_view, ext.size(), [=](const int idx) restrict(amp)
+            {
+                func(unflatten(idx, ext));
+            });
+        }
+
+        //----------------------------------------------------------------------------
+        // scratch memory pool
+        //----------------------------------------------------------------------------
+        //
+        // Temporaries are drawn from a cache of 32-bit word arrays kept for each accelerator_view, bucketed by 
+        // power of two size, and viewed as the element type with reinterpret_as(). Work on an accelerator_view 
+        // runs in submission order, so a buffer released while kernels that use it are still queued can be 
+        // handed straight to the next caller on the same view. Staging buffers, which live on the CPU 
+        // accelerator with the view as their associated accelerator_view, are cached alongside the device 
+        // buffers for results that are read back on the host.
+
+        enum class scratch_kind : int
+        {
+            device = 0,
+            staging = 1
+        };
+
+        class scratch_pool
+        {
+        public:
+            typedef std::shared_ptr<concurrency::array<unsigned int>> buffer_ptr;
+
+            static const size_t default_high_water_mark = 64 * 1024 * 1024;
+
+            explicit scratch_pool(const concurrency::accelerator_view& accl_view) : 
+                m_accl_view(accl_view), m_cached_bytes(0), m_high_water_mark(default_high_water_mark)
+            {
+            }
+
+            // Returns a buffer of at least word_count words. Requests larger than the biggest bucket are 
+            // allocated exactly and never cached.
+            buffer_ptr acquire(const int word_count, const scratch_kind kind = scratch_kind::device)
+            {
+                const int bucket = bucket_index(word_count);
+                if (bucket >= bucket_count)
+                {
+                    return allocate(word_count, kind);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    std::vector<buffer_ptr>& free_list = m_free_lists[static_cast<int>(kind)][bucket];
+                    if (!free_list.empty())
+                    {
+                        buffer_ptr buffer = free_list.back();
+                        free_list.pop_back();
+                        m_cached_bytes -= bucket_bytes(bucket);
+                        return buffer;
+                    }
+                }
+                return allocate(bucket_words(bucket), kind);
+            }
+
+            // Returns a buffer to its bucket, or frees it if caching it would exceed the high-water mark.
+            void release(const buffer_ptr& buffer, const scratch_kind kind = scratch_kind::device)
+            {
+                const int word_count = buffer->extent.size();
+                const int bucket = bucket_index(word_count);
+                if ((bucket >= bucket_count) || (bucket_words(bucket) != word_count))
+                {
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_cached_bytes + bucket_bytes(bucket) <= m_high_water_mark)
+                {
+                    m_free_lists[static_cast<int>(kind)][bucket].push_back(buffer);
+                    m_cached_bytes += bucket_bytes(bucket);
+                }
+            }
+
+            // Frees cached buffers, largest first, until no more than max_cached_bytes remain.
+            void trim(const size_t max_cached_bytes)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                trim_locked(max_cached_bytes);
+            }
+
+            size_t cached_bytes() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_cached_bytes;
+            }
+
+            size_t high_water_mark() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_high_water_mark;
+            }
+
+            void set_high_water_mark(const size_t bytes)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_high_water_mark = bytes;
+                trim_locked(bytes);
+            }
+
+            const concurrency::accelerator_view& accl_view() const
+            {
+                return m_accl_view;
+            }
+
+        private:
+            // Buckets hold 2^8 (1 KB) to 2^24 (64 MB) words. Above that rounding up to the next power of two 
+            // could waste nearly as much as is used, so larger requests are allocated exactly.
+            static const int min_bucket_log2 = 8;
+            static const int bucket_count = 17;
+            static const int kind_count = 2;
+
+            scratch_pool(const scratch_pool&);
+            scratch_pool& operator=(const scratch_pool&);
+
+            buffer_ptr allocate(const int word_count, const scratch_kind kind) const
+            {
+                if (kind == scratch_kind::staging)
+                {
+                    return std::make_shared<concurrency::array<unsigned int>>(word_count, 
+                        concurrency::accelerator(concurrency::accelerator::cpu_accelerator).default_view, m_accl_view);
+                }
+                return std::make_shared<concurrency::array<unsigned int>>(word_count, m_accl_view);
+            }
+
+            static int bucket_index(const int word_count)
+            {
+                int bucket = 0;
+                while ((bucket < bucket_count) && (bucket_words(bucket) < word_count))
+                {
+                    ++bucket;
+                }
+                return bucket;
+            }
+
+            static int bucket_words(const int bucket)
+            {
+                return 1 << (min_bucket_log2 + bucket);
+            }
+
+            static size_t bucket_bytes(const int bucket)
+            {
+                return static_cast<size_t>(bucket_words(bucket)) * sizeof(unsigned int);
+            }
+
+            void trim_locked(const size_t max_cached_bytes)
+            {
+                for (int bucket = bucket_count - 1; (bucket >= 0) && (m_cached_bytes > max_cached_bytes); --bucket)
+                {
+                    for (int kind = 0; kind < kind_count; ++kind)
+                    {
+                        std::vector<buffer_ptr>& free_list = m_free_lists[kind][bucket];
+                        while (!free_list.empty() && (m_cached_bytes > max_cached_bytes))
+                        {
+                            free_list.pop_back();
+                            m_cached_bytes -= bucket_bytes(bucket);
+                        }
+                    }
+                }
+            }
+
+            concurrency::accelerator_view m_accl_view;
+            std::vector<buffer_ptr> m_free_lists[kind_count][bucket_count];
+            size_t m_cached_bytes;
+            size_t m_high_water_mark;
+            mutable std::mutex m_mutex;
+        };
+
+        // One pool per accelerator_view, created on first use and kept until release_scratch_pool() is called 
+        // for the view. The members are static members of a class template so that the header can define them.
+
+        template <typename Dummy = void>
+        struct scratch_pool_registry
+        {
+            static std::mutex mutex;
+            static std::vector<std::shared_ptr<scratch_pool>> pools;
+        };
+
+        template <typename Dummy>
+        std::mutex scratch_pool_registry<Dummy>::mutex;
+
+        template <typename Dummy>
+        std::vector<std::shared_ptr<scratch_pool>> scratch_pool_registry<Dummy>::pools;
+
+        inline std::shared_ptr<scratch_pool> get_scratch_pool(const concurrency::accelerator_view& accl_view)
+        {
+            std::lock_guard<std::mutex> lock(scratch_pool_registry<>::mutex);
+            for (const auto& pool : scratch_pool_registry<>::pools)
+            {
+                if (pool->accl_view() == accl_view)
+                {
+                    return pool;
+                }
+            }
+            scratch_pool_registry<>::pools.push_back(std::make_shared<scratch_pool>(accl_view));
+            return scratch_pool_registry<>::pools.back();
+        }
+
+        // Drops the registry's reference to the view's pool. Scratch arrays still in use keep the pool alive 
+        // until they are destroyed; their buffers are then freed along with it.
+        inline void release_scratch_pool(const concurrency::accelerator_view& accl_view)
+        {
+            std::lock_guard<std::mutex> lock(scratch_pool_registry<>::mutex);
+            auto& pools = scratch_pool_registry<>::pools;
+            pools.erase(std::remove_if(pools.begin(), pools.end(), 
+                [&](const std::shared_ptr<scratch_pool>& pool) { return pool->accl_view() == accl_view; }), pools.end());
+        }
+
+        // A temporary array of element_count elements of T drawn from the accelerator_view's scratch pool and 
+        // returned to it on destruction. The contents are undefined until written.
+
+        template <typename T>
+        class scratch_array
+        {
+        public:
+            scratch_array(const int element_count, const concurrency::accelerator_view& accl_view, const scratch_kind kind = scratch_kind::device) : 
+                m_pool(get_scratch_pool(accl_view)), 
+                m_buffer(m_pool->acquire(word_count(element_count), kind)), 
+                m_element_count(element_count), 
+                m_kind(kind)
+            {
+                static_assert((sizeof(T) % sizeof(unsigned int)) == 0, "The element size must be a multiple of 4 bytes.");
+            }
+
+            scratch_array(scratch_array&& other) : 
+                m_pool(std::move(other.m_pool)), m_buffer(std::move(other.m_buffer)), m_element_count(other.m_element_count), m_kind(other.m_kind)
+            {
+            }
+
+            ~scratch_array()
+            {
+                if (m_buffer)
+                {
+                    m_pool->release(m_buffer, m_kind);
+                }
+            }
+
+            concurrency::array_view<T> view() const
+            {
+                return m_buffer->reinterpret_as<T>().section(0, m_element_count);
+            }
+
+        private:
+            scratch_array(const scratch_array&);
+            scratch_array& operator=(const scratch_array&);
+
+            static int word_count(const int element_count)
+            {
+                const int words = static_cast<int>((static_cast<size_t>(element_count) * sizeof(T)) / sizeof(unsigned int));
+                return (words > 0) ? words : 1;
+            }
+
+            std::shared_ptr<scratch_pool> m_pool;
+            scratch_pool::buffer_ptr m_buffer;
+            int m_element_count;
+            scratch_kind m_kind;
+        };
+
         //----------------------------------------------------------------------------
         // reduce implementation
         //---------------------------------------------------------------------------- 
@@ -136,94 +457,103 @@ namespace amp_algorithms
         // The output (reduced result) is contained in "mem[0]" at the end of this function
         // The parameter "partial_data_length" is used to indicate if the size of data in "mem" to be
         // reduced is same as the tile size and if not what is the length of valid data in "mem".
+        //
+        // The tree is unrolled at compile time by reduce_tile_level, one level per halving of the stride, so 
+        // the number of levels and their strides are constants for the shader compiler. Full and partial tiles 
+        // share the same code: the combine at each level is guarded by partial_data_length but the barrier is 
+        // not, so every thread reaches every barrier whatever the length.
+        //
+        // The barrier is kept on the levels whose active threads would fit in one hardware wavefront. C++ AMP 
+        // gives no lockstep guarantee within a tile and no way to query the wavefront width, so dropping the 
+        // barrier there would be a data race on tile_static memory, and the WARP and reference accelerators do 
+        // not run threads in lockstep at all.
 
-        template <unsigned int tile_size, typename functor, typename T>
-        void reduce_tile(T* const mem, concurrency::tiled_index<tile_size> tid, const functor& op, int partial_data_length) restrict(amp)
+        template <unsigned int tile_size, unsigned int stride>
+        struct reduce_tile_level
         {
-            const int lidx = tid.local[0];
-
-            if (partial_data_length < tile_size)
+            template <typename functor, typename T>
+            static void reduce(T* const mem, const concurrency::tiled_index<tile_size>& tid, const functor& op, const int partial_data_length) restrict(amp)
             {
-                // unrolled for performance
-                if (partial_data_length > 512) { if (lidx < (partial_data_length - 512)) { mem[0] = op(mem[0], mem[512]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (partial_data_length > 256) { if (lidx < (partial_data_length - 256)) { mem[0] = op(mem[0], mem[256]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (partial_data_length > 128) { if (lidx < (partial_data_length - 128)) { mem[0] = op(mem[0], mem[128]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (partial_data_length > 64) { if (lidx < (partial_data_length - 64)) { mem[0] = op(mem[0], mem[64]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (partial_data_length > 32) { if (lidx < (partial_data_length - 32)) { mem[0] = op(mem[0], mem[32]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (partial_data_length > 16) { if (lidx < (partial_data_length - 16)) { mem[0] = op(mem[0], mem[16]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (partial_data_length > 8) { if (lidx < (partial_data_length - 8)) { mem[0] = op(mem[0], mem[8]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (partial_data_length > 4) { if (lidx < (partial_data_length - 4)) { mem[0] = op(mem[0], mem[4]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (partial_data_length > 2) { if (lidx < (partial_data_length - 2)) { mem[0] = op(mem[0], mem[2]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (partial_data_length > 1) { if (lidx < (partial_data_length - 1)) { mem[0] = op(mem[0], mem[1]); } tid.barrier.wait_with_tile_static_memory_fence(); }
+                const int lidx = tid.local[0];
+                if ((lidx < static_cast<int>(stride)) && ((lidx + static_cast<int>(stride)) < partial_data_length))
+                {
+                    mem[0] = op(mem[0], mem[stride]);
+                }
+                tid.barrier.wait_with_tile_static_memory_fence();
+
+                reduce_tile_level<tile_size, stride / 2>::reduce(mem, tid, op, partial_data_length);
             }
-            else
+        };
+
+        template <unsigned int tile_size>
+        struct reduce_tile_level<tile_size, 0>
+        {
+            template <typename functor, typename T>
+            static void reduce(T* const, const concurrency::tiled_index<tile_size>&, const functor&, const int) restrict(amp)
             {
-                // unrolled for performance
-                if (tile_size >= 1024) { if (lidx < 512) { mem[0] = op(mem[0], mem[512]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (tile_size >= 512) { if (lidx < 256) { mem[0] = op(mem[0], mem[256]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (tile_size >= 256) { if (lidx < 128) { mem[0] = op(mem[0], mem[128]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (tile_size >= 128) { if (lidx < 64) { mem[0] = op(mem[0], mem[64]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (tile_size >= 64) { if (lidx < 32) { mem[0] = op(mem[0], mem[32]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (tile_size >= 32) { if (lidx < 16) { mem[0] = op(mem[0], mem[16]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (tile_size >= 16) { if (lidx < 8) { mem[0] = op(mem[0], mem[8]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (tile_size >= 8) { if (lidx < 4) { mem[0] = op(mem[0], mem[4]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (tile_size >= 4) { if (lidx < 2) { mem[0] = op(mem[0], mem[2]); } tid.barrier.wait_with_tile_static_memory_fence(); }
-                if (tile_size >= 2) { if (lidx < 1) { mem[0] = op(mem[0], mem[1]); } tid.barrier.wait_with_tile_static_memory_fence(); }
             }
+        };
+
+        template <unsigned int tile_size, typename functor, typename T>
+        void reduce_tile(T* const mem, concurrency::tiled_index<tile_size> tid, const functor& op, int partial_data_length) restrict(amp)
+        {
+            static_assert((tile_size & (tile_size - 1)) == 0, "The tile size must be a power of 2");
+            reduce_tile_level<tile_size, tile_size / 2>::reduce(mem, tid, op, partial_data_length);
         }
 
-        // Generic reduction of a 1D indexable view with a reduction binary functor
+        // Generic map-reduce over the 1D index space [0, element_count). Each element is produced by calling 
+        // load_op(idx) as it is folded into the tile buffer, so no intermediate array is needed to hold the 
+        // mapped values. The first pass leaves one partial result per tile in global_buffer_view, which must 
+        // hold transform_reduce_tile_count() elements.
+
+        template<unsigned int tile_size, unsigned int max_tiles>
+        inline int transform_reduce_tile_count(const int element_count)
+        {
+            return static_cast<int>(std::min(max_tiles, (element_count + tile_size - 1) / tile_size));
+        }
 
         template<unsigned int tile_size,
             unsigned int max_tiles,
-            typename InputIndexableView,
+            typename T,
+            typename IndexFunction,
             typename BinaryFunction>
-            typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type
-            reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op)
+            void transform_reduce_tiles(const concurrency::accelerator_view &accl_view, const int element_count, const IndexFunction &load_op, const BinaryFunction &binary_op, 
+                const concurrency::array_view<T> &global_buffer_view)
         {
-            // The input view must be of rank 1
-            static_assert(indexable_view_traits<InputIndexableView>::rank == 1, "The input indexable view must be of rank 1");
-            typedef typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type result_type;
-
             // runtime sizes
-            const int n = input_view.extent.size();
-            const unsigned int tile_count = std::min(max_tiles, (n + tile_size - 1) / tile_size);
+            const int n = element_count;
+            const unsigned int tile_count = transform_reduce_tile_count<tile_size, max_tiles>(n);
             const unsigned int thread_count = tile_count * tile_size;
 
-            // global buffer (return type)
-            concurrency::array_view<result_type> global_buffer_view(concurrency::array<result_type>(tile_count, concurrency::accelerator(concurrency::accelerator::cpu_accelerator).default_view, accl_view));
-
             _details::parallel_for_each(
                 accl_view,
                 concurrency::extent<1>(thread_count).tile<tile_size>(),
                 [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
             {
                 // shared tile buffer
-                tile_static result_type local_buffer[tile_size];
+                tile_static T local_buffer[tile_size];
 
                 int idx = tidx.global[0];
 
                 // this thread's shared memory pointer
-                result_type& smem = local_buffer[tidx.local[0]];
-
-                // initialize local buffer
-                smem = input_view[concurrency::index<1>(idx)];
-                // next chunk
-                idx += thread_count;
+                T& smem = local_buffer[tidx.local[0]];
 
-                // fold data into local buffer
-                while (idx < n)
+                // fold this thread's chunks in a register and then store the result in the local buffer, threads 
+                // past the end of the data are excluded by partial_data_length
+                if (idx < n)
                 {
-                    // reduction of smem and X[idx] with results stored in smem
-                    smem = binary_op(smem, input_view[concurrency::index<1>(idx)]);
-                    // next chunk
-                    idx += thread_count;
+                    T value = load_op(idx);
+                    for (idx += thread_count; idx < n; idx += thread_count)
+                    {
+                        value = binary_op(value, load_op(idx));
+                    }
+                    smem = value;
                 }
 
                 tidx.barrier.wait_with_tile_static_memory_fence();
 
                 // this variable is used to test if we are on the edge of data within the tile
-                int partial_data_length = tile_partial_data_size(input_view, tidx);
+                int partial_data_length = n - tidx.tile[0] * tile_size;
                 // reduce all values in this tile
                 _details::reduce_tile(&smem, tidx, binary_op, partial_data_length);
 
@@ -232,11 +562,28 @@ namespace amp_algorithms
                     global_buffer_view[tidx.tile[0]] = smem;
                 }
             });
+        }
+
+        template<unsigned int tile_size,
+            unsigned int max_tiles,
+            typename T,
+            typename IndexFunction,
+            typename BinaryFunction>
+            T transform_reduce(const concurrency::accelerator_view &accl_view, const int element_count, const IndexFunction &load_op, const BinaryFunction &binary_op)
+        {
+            const unsigned int tile_count = transform_reduce_tile_count<tile_size, max_tiles>(element_count);
+
+            // global buffer (return type), a staging array so that the readback needs no extra copy
+            const scratch_array<T> global_buffer(tile_count, accl_view, scratch_kind::staging);
+            const concurrency::array_view<T> global_buffer_view = global_buffer.view();
+
+            transform_reduce_tiles<tile_size, max_tiles, T>(accl_view, element_count, load_op, binary_op, global_buffer_view);
 
             // 2nd pass reduction
 
-            const result_type *pGlobalBufferViewData = global_buffer_view.data();
-            result_type retVal = pGlobalBufferViewData[0];
+            _details::traced_synchronize(global_buffer_view);
+            const T *pGlobalBufferViewData = global_buffer_view.data();
+            T retVal = pGlobalBufferViewData[0];
             for (unsigned int i = 1; i < tile_count; ++i) 
             {
                 retVal = binary_op(retVal, pGlobalBufferViewData[i]);
@@ -244,6 +591,457 @@ namespace amp_algorithms
             return retVal;
         }
 
+        // As transform_reduce() but the per-tile results are reduced by a second, single tile pass on the 
+        // accelerator, which writes the result to result_view[0]. Nothing waits for the kernels to complete. An 
+        // empty input leaves result_view unchanged.
+
+        template<unsigned int tile_size,
+            unsigned int max_tiles,
+            typename T,
+            typename IndexFunction,
+            typename BinaryFunction>
+            void transform_reduce_async(const concurrency::accelerator_view &accl_view, const int element_count, const IndexFunction &load_op, const BinaryFunction &binary_op, 
+                const concurrency::array_view<T> &result_view)
+        {
+            if (element_count <= 0)
+            {
+                return;
+            }
+            const int tile_count = transform_reduce_tile_count<tile_size, max_tiles>(element_count);
+            const scratch_array<T> tile_results(tile_count, accl_view);
+            const concurrency::array_view<T> tile_results_vw = tile_results.view();
+
+            transform_reduce_tiles<tile_size, max_tiles, T>(accl_view, element_count, load_op, binary_op, tile_results_vw);
+            transform_reduce_tiles<tile_size, 1, T>(accl_view, tile_count, 
+                [=](const int idx) restrict(amp) { return tile_results_vw[idx]; }, binary_op, result_view);
+        }
+
+        // Generic reduction of a 1D indexable view with a reduction binary functor
+
+        template<unsigned int tile_size,
+            unsigned int max_tiles,
+            typename InputIndexableView,
+            typename BinaryFunction>
+            typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type
+            reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op)
+        {
+            // The input view must be of rank 1
+            static_assert(indexable_view_traits<InputIndexableView>::rank == 1, "The input indexable view must be of rank 1");
+            typedef typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type result_type;
+
+            return transform_reduce<tile_size, max_tiles, result_type>(accl_view, input_view.extent.size(), 
+                [=](const int idx) restrict(amp) { return input_view[concurrency::index<1>(idx)]; }, binary_op);
+        }
+
+        // Reproducible reduction. The input is split into fixed size blocks of tile_size * items_per_thread 
+        // elements. Each thread folds its items in order, each tile reduces a block with reduce_tile() and the 
+        // block results are reduced in the same way until one value remains. The shape of the combination tree 
+        // therefore depends only on the number of elements and the two template parameters, not on max_tiles, the 
+        // number of tiles launched or a fold on the host, so a float sum is bitwise identical from run to run and 
+        // on any accelerator with the same arithmetic.
+
+        template<unsigned int tile_size,
+            unsigned int items_per_thread,
+            unsigned int max_tiles,
+            typename InputIndexableView,
+            typename T,
+            typename BinaryFunction>
+            void reproducible_reduce_blocks(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, 
+            const concurrency::array_view<T> &output_view, const BinaryFunction &binary_op)
+        {
+            const int block_size = tile_size * items_per_thread;
+            const int n = input_view.extent.size();
+            const int block_count = output_view.extent[0];
+            const int tile_count = std::min(static_cast<int>(max_tiles), block_count);
+            const int pass_count = (block_count + tile_count - 1) / tile_count;
+
+            _details::parallel_for_each(accl_view, concurrency::extent<1>(tile_count * tile_size).tile<tile_size>(), 
+                [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                tile_static T local_buffer[tile_size];
+                const int lidx = tidx.local[0];
+
+                for (int pass = 0; pass < pass_count; ++pass)
+                {
+                    const int block = (pass * tile_count) + tidx.tile[0];
+                    const int block_first = block * block_size;
+                    const int first = block_first + (lidx * items_per_thread);
+                    if (first < n)
+                    {
+                        T value = input_view[concurrency::index<1>(first)];
+                        for (int i = 1; (i < items_per_thread) && ((first + i) < n); ++i)
+                        {
+                            value = binary_op(value, input_view[concurrency::index<1>(first + i)]);
+                        }
+                        local_buffer[lidx] = value;
+                    }
+                    tidx.barrier.wait_with_tile_static_memory_fence();
+
+                    // The number of threads with data depends only on n and the block.
+                    const int partial_data_length = amp_algorithms::max<int>()(0, 
+                        amp_algorithms::min<int>()(tile_size, (n - block_first + items_per_thread - 1) / items_per_thread));
+                    _details::reduce_tile(&local_buffer[lidx], tidx, binary_op, partial_data_length);
+
+                    if ((lidx == 0) && (block < block_count))
+                    {
+                        output_view[block] = local_buffer[0];
+                    }
+                    tidx.barrier.wait_with_tile_static_memory_fence();
+                }
+            });
+        }
+
+        // Reduces input_view into result_view[0] without waiting for the kernels. Each level of partials is 
+        // reduced by a recursive call until a single block remains, which writes straight to result_view.
+
+        template<unsigned int tile_size,
+            unsigned int items_per_thread,
+            typename InputIndexableView,
+            typename BinaryFunction,
+            typename T>
+            void reproducible_reduce_async(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op, 
+                const concurrency::array_view<T> &result_view)
+        {
+            static_assert(indexable_view_traits<InputIndexableView>::rank == 1, "The input indexable view must be of rank 1");
+            static const int block_size = tile_size * items_per_thread;
+
+            const int count = (input_view.extent.size() + block_size - 1) / block_size;
+            if (count <= 1)
+            {
+                if (count == 1)
+                {
+                    reproducible_reduce_blocks<tile_size, items_per_thread, 10000>(accl_view, input_view, result_view.section(0, 1), binary_op);
+                }
+                return;
+            }
+            concurrency::array<T> partials(count, accl_view);
+            reproducible_reduce_blocks<tile_size, items_per_thread, 10000>(accl_view, input_view, concurrency::array_view<T>(partials), binary_op);
+            reproducible_reduce_async<tile_size, items_per_thread>(accl_view, concurrency::array_view<const T>(partials), binary_op, result_view);
+        }
+
+        template<unsigned int tile_size,
+            unsigned int items_per_thread,
+            typename InputIndexableView,
+            typename BinaryFunction>
+            typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type
+            reproducible_reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const BinaryFunction &binary_op)
+        {
+            typedef typename std::result_of<BinaryFunction(const typename indexable_view_traits<InputIndexableView>::value_type&, const typename indexable_view_traits<InputIndexableView>::value_type&)>::type result_type;
+
+            concurrency::array<result_type> partial(1, accl_view);
+            reproducible_reduce_async<tile_size, items_per_thread>(accl_view, input_view, binary_op, concurrency::array_view<result_type>(partial));
+
+            result_type result;
+            _details::traced_copy(partial, stdext::make_checked_array_iterator(&result, 1));
+            return result;
+        }
+
+        // Batched reduction of the segments [offsets[i], offsets[i + 1]) of a rank 1 view whose indices are listed 
+        // in segments_view, at list_first + (item * list_step) for each item below list_size_vw[0]. Each segment is 
+        // reduced by a group of group_size threads within a tile. The grid is sized on the host for max_list_size 
+        // items, so the list size is only read on the accelerator and needs no readback. Tiles loop over the 
+        // items in passes when there are more than max_tiles tiles worth of groups.
+        //
+        // The group tree always runs for log2(group_size) steps and only guards the combine with the segment 
+        // length. As in reduce_tile() no barrier depends on a value read from memory, which would not be tile 
+        // uniform as far as the shader compiler can tell; the list size only guards loads and stores.
+
+        template<unsigned int tile_size,
+            unsigned int group_size,
+            unsigned int max_tiles,
+            typename InputIndexableView,
+            typename OffsetsIndexableView,
+            typename BinaryFunction,
+            typename OutputIndexableView>
+            void segmented_reduce_groups(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const OffsetsIndexableView &offsets_view, 
+            const concurrency::array_view<const int>& segments_view, const int list_first, const int list_step, 
+            const concurrency::array_view<const int>& list_size_vw, const int max_list_size, const BinaryFunction &binary_op, OutputIndexableView &output_view)
+        {
+            static_assert((tile_size % group_size) == 0, "The group size must divide the tile size");
+            typedef typename std::remove_const<typename indexable_view_traits<OutputIndexableView>::value_type>::type T;
+
+            if (max_list_size == 0)
+            {
+                return;
+            }
+            const int groups_per_tile = tile_size / group_size;
+            const int tile_count = std::min(static_cast<int>(max_tiles), (max_list_size + groups_per_tile - 1) / groups_per_tile);
+            const int pass_count = (max_list_size + (tile_count * groups_per_tile) - 1) / (tile_count * groups_per_tile);
+
+            _details::parallel_for_each(accl_view, concurrency::extent<1>(tile_count * tile_size).tile<tile_size>(), 
+                [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                tile_static T local_buffer[tile_size];
+                const int lidx = tidx.local[0];
+                const int group_lidx = lidx % group_size;
+                const int group = lidx / group_size;
+                const int list_size = list_size_vw[0];
+
+                for (int pass = 0; pass < pass_count; ++pass)
+                {
+                    const int item = (((pass * tile_count) + tidx.tile[0]) * groups_per_tile) + group;
+                    int segment = 0;
+                    int segment_length = 0;
+                    if (item < list_size)
+                    {
+                        segment = segments_view[list_first + (item * list_step)];
+                        const int segment_first = offsets_view[segment];
+                        segment_length = offsets_view[segment + 1] - segment_first;
+                        if (group_lidx < segment_length)
+                        {
+                            T value = input_view[segment_first + group_lidx];
+                            for (int i = group_lidx + group_size; i < segment_length; i += group_size)
+                            {
+                                value = binary_op(value, input_view[segment_first + i]);
+                            }
+                            local_buffer[lidx] = value;
+                        }
+                    }
+                    tidx.barrier.wait_with_tile_static_memory_fence();
+
+                    const int active_length = amp_algorithms::min<int>()(segment_length, group_size);
+                    for (int stride = group_size / 2; stride > 0; stride /= 2)
+                    {
+                        if ((group_lidx < stride) && ((group_lidx + stride) < active_length))
+                        {
+                            local_buffer[lidx] = binary_op(local_buffer[lidx], local_buffer[lidx + stride]);
+                        }
+                        tidx.barrier.wait_with_tile_static_memory_fence();
+                    }
+
+                    if ((group_lidx == 0) && (segment_length > 0))
+                    {
+                        output_view[segment] = local_buffer[lidx];
+                    }
+                }
+            });
+        }
+
+        // Reduction of the segments [offsets[i], offsets[i + 1]) of a rank 1 view. The non-empty segments are first 
+        // binned by length into lists of short, medium and long segments, which are then reduced by single threads, 
+        // by groups of 32 threads and by whole tiles respectively, so that a few long segments among many short 
+        // ones, or the reverse, do not leave most threads idle or serialize the long ones.
+        //
+        // The list sizes stay on the accelerator. The grids are sized from bounds known on the host: there are 
+        // at most segment_count short segments, and as segments do not overlap at most n / 16 medium and 
+        // n / 1024 long ones for n input elements. Short and long segments together number at most 
+        // segment_count, so their lists share one region, filled from either end. Nothing waits for the 
+        // kernels to complete.
+
+        static const int segmented_reduce_short_length = 16;
+        static const int segmented_reduce_long_length = 1024;
+
+        template<unsigned int tile_size,
+            unsigned int max_tiles,
+            typename InputIndexableView,
+            typename OffsetsIndexableView,
+            typename BinaryFunction,
+            typename OutputIndexableView>
+            void segmented_reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const OffsetsIndexableView &offsets_view, 
+            const BinaryFunction &binary_op, OutputIndexableView &output_view)
+        {
+            static const int bin_count = 3;
+            const int segment_count = offsets_view.extent[0] - 1;
+            const int element_count = input_view.extent[0];
+            const int short_length = segmented_reduce_short_length;
+            const int long_length = segmented_reduce_long_length;
+            const int max_medium_count = std::min(segment_count, element_count / short_length);
+            const int max_long_count = std::min(segment_count, element_count / long_length);
+
+            // The bin sizes, then the short and long list, then the medium list.
+            const scratch_array<int> scratch(bin_count + segment_count + max_medium_count, accl_view);
+            const concurrency::array_view<int> bin_sizes_vw = scratch.view().section(0, bin_count);
+            const concurrency::array_view<int> lists_vw = scratch.view().section(bin_count, segment_count + max_medium_count);
+
+            for_each_index(accl_view, bin_count, [=](const int idx) restrict(amp)
+            {
+                bin_sizes_vw[idx] = 0;
+            });
+            for_each_index(accl_view, segment_count, [=](const int segment) restrict(amp)
+            {
+                const int segment_length = offsets_view[segment + 1] - offsets_view[segment];
+                if (segment_length <= 0)
+                {
+                    return;
+                }
+                if (segment_length < short_length)
+                {
+                    lists_vw[concurrency::atomic_fetch_inc(&bin_sizes_vw[0])] = segment;
+                }
+                else if (segment_length < long_length)
+                {
+                    lists_vw[segment_count + concurrency::atomic_fetch_inc(&bin_sizes_vw[1])] = segment;
+                }
+                else
+                {
+                    lists_vw[segment_count - 1 - concurrency::atomic_fetch_inc(&bin_sizes_vw[2])] = segment;
+                }
+            });
+
+            segmented_reduce_groups<tile_size, 1, max_tiles>(accl_view, input_view, offsets_view, 
+                lists_vw, 0, 1, bin_sizes_vw.section(0, 1), segment_count, binary_op, output_view);
+            segmented_reduce_groups<tile_size, 32, max_tiles>(accl_view, input_view, offsets_view, 
+                lists_vw, segment_count, 1, bin_sizes_vw.section(1, 1), max_medium_count, binary_op, output_view);
+            segmented_reduce_groups<tile_size, tile_size, max_tiles>(accl_view, input_view, offsets_view, 
+                lists_vw, segment_count - 1, -1, bin_sizes_vw.section(2, 1), max_long_count, binary_op, output_view);
+        }
+
+        // Axis reduction helpers. insert_axis() maps an index into the output of an axis reduction back to the 
+        // input element at position value along the reduced axis, remove_axis() gives the extent of the output.
+
+        template <int N>
+        inline concurrency::index<N + 1> insert_axis(const concurrency::index<N>& idx, const int axis, const int value) restrict(cpu, amp)
+        {
+            concurrency::index<N + 1> result;
+            for (int i = 0, j = 0; i < (N + 1); ++i)
+            {
+                result[i] = (i == axis) ? value : idx[j++];
+            }
+            return result;
+        }
+
+        template <int N>
+        inline concurrency::extent<N - 1> remove_axis(const concurrency::extent<N>& ext, const int axis)
+        {
+            concurrency::extent<N - 1> result;
+            for (int i = 0, j = 0; i < N; ++i)
+            {
+                if (i != axis)
+                {
+                    result[j++] = ext[i];
+                }
+            }
+            return result;
+        }
+
+        // Reduction of a rank 2 or rank 3 view along one axis into a view with that axis removed.
+        //
+        // When the reduced axis is the contiguous one, the last for dense views, a tile reduces each row so that its 
+        // threads read consecutive elements. Otherwise the columns of a tile reduce neighboring output elements, 
+        // so that they read neighboring elements of each slice along the axis and the reads are still coalesced, 
+        // while its rows split the reduced axis between them. No transposed copy of the input is needed.
+
+        template<unsigned int tile_size,
+            unsigned int max_tiles,
+            typename InputIndexableView,
+            typename BinaryFunction,
+            typename OutputIndexableView>
+            void reduce(const concurrency::accelerator_view &accl_view, const InputIndexableView &input_view, const int axis, const BinaryFunction &binary_op, OutputIndexableView &output_view)
+        {
+            static const int rank = indexable_view_traits<InputIndexableView>::rank;
+            static_assert((rank == 2) || (rank == 3), "The input indexable view must be of rank 2 or 3");
+            static_assert(indexable_view_traits<OutputIndexableView>::rank == (rank - 1), "The output indexable view must be of rank one less than the input");
+            typedef typename std::remove_const<typename indexable_view_traits<OutputIndexableView>::value_type>::type T;
+
+            if ((axis < 0) || (axis >= rank))
+            {
+                throw concurrency::runtime_exception("The axis must be less than the rank of the input view.", E_INVALIDARG);
+            }
+            const int axis_length = input_view.extent[axis];
+            const concurrency::extent<rank - 1> output_extent = output_view.extent;
+            if (output_extent != remove_axis(concurrency::extent<rank>(input_view.extent), axis))
+            {
+                throw concurrency::runtime_exception("The output view extent must be the input view extent without the reduced axis.", E_INVALIDARG);
+            }
+            if ((axis_length == 0) || (output_extent.size() == 0))
+            {
+                return;
+            }
+
+            const int contiguous_axis = (indexable_view_traits<InputIndexableView>::contiguous_dimension < 0) ? 
+                (rank - 1) : indexable_view_traits<InputIndexableView>::contiguous_dimension;
+            if (axis == contiguous_axis)
+            {
+                const int row_count = output_extent.size();
+                const int tile_count = std::min(row_count, static_cast<int>(max_tiles));
+                const int rows_per_tile = (row_count + tile_count - 1) / tile_count;
+                const int partial_data_length = std::min(axis_length, static_cast<int>(tile_size));
+
+                _details::parallel_for_each(accl_view, concurrency::extent<1>(tile_count * tile_size).tile<tile_size>(), 
+                    [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+                {
+                    tile_static T local_buffer[tile_size];
+                    const int lidx = tidx.local[0];
+
+                    // All threads take part in every pass so that the barriers in reduce_tile are reached uniformly.
+                    for (int pass = 0; pass < rows_per_tile; ++pass)
+                    {
+                        const int row = tidx.tile[0] + pass * tile_count;
+                        const concurrency::index<rank - 1> output_idx = unflatten(row, output_extent);
+                        if ((row < row_count) && (lidx < axis_length))
+                        {
+                            T value = input_view[insert_axis(output_idx, axis, lidx)];
+                            for (int i = lidx + tile_size; i < axis_length; i += tile_size)
+                            {
+                                value = binary_op(value, input_view[insert_axis(output_idx, axis, i)]);
+                            }
+                            local_buffer[lidx] = value;
+                        }
+                        tidx.barrier.wait_with_tile_static_memory_fence();
+
+                        _details::reduce_tile(&local_buffer[lidx], tidx, binary_op, partial_data_length);
+
+                        if ((lidx == 0) && (row < row_count))
+                        {
+                            output_view[output_idx] = local_buffer[0];
+                        }
+                        tidx.barrier.wait_with_tile_static_memory_fence();
+                    }
+                });
+            }
+            else
+            {
+                static const int axis_rows = 8;
+                static const int output_columns = 32;
+                const int output_count = output_extent.size();
+                const int tile_count = std::min((output_count + output_columns - 1) / output_columns, static_cast<int>(max_tiles));
+                const int columns_per_pass = tile_count * output_columns;
+                const int pass_count = (output_count + columns_per_pass - 1) / columns_per_pass;
+                const int row_count = std::min(axis_length, axis_rows);
+
+                _details::parallel_for_each(accl_view, concurrency::extent<2>(axis_rows, columns_per_pass).tile<axis_rows, output_columns>(), 
+                    [=](concurrency::tiled_index<axis_rows, output_columns> tidx) restrict(amp)
+                {
+                    tile_static T local_buffer[axis_rows][output_columns];
+                    const int row = tidx.local[0];
+                    const int column = tidx.local[1];
+
+                    // All threads take part in every pass so that the barriers are reached uniformly.
+                    for (int pass = 0; pass < pass_count; ++pass)
+                    {
+                        const int output = tidx.global[1] + pass * columns_per_pass;
+                        const concurrency::index<rank - 1> output_idx = unflatten(output, output_extent);
+                        if ((output < output_count) && (row < axis_length))
+                        {
+                            T value = input_view[insert_axis(output_idx, axis, row)];
+                            for (int i = row + axis_rows; i < axis_length; i += axis_rows)
+                            {
+                                value = binary_op(value, input_view[insert_axis(output_idx, axis, i)]);
+                            }
+                            local_buffer[row][column] = value;
+                        }
+                        tidx.barrier.wait_with_tile_static_memory_fence();
+
+                        // Combine the rows of each column pairwise.
+                        for (int stride = 1; stride < axis_rows; stride *= 2)
+                        {
+                            if (((row % (2 * stride)) == 0) && ((row + stride) < row_count))
+                            {
+                                local_buffer[row][column] = binary_op(local_buffer[row][column], local_buffer[row + stride][column]);
+                            }
+                            tidx.barrier.wait_with_tile_static_memory_fence();
+                        }
+
+                        if ((row == 0) && (output < output_count))
+                        {
+                            output_view[output_idx] = local_buffer[0][column];
+                        }
+                        tidx.barrier.wait_with_tile_static_memory_fence();
+                    }
+                });
+            }
+        }
+
         //----------------------------------------------------------------------------
         // scan - C++ AMP implementation
         //----------------------------------------------------------------------------
@@ -304,15 +1102,15 @@ namespace amp_algorithms
             typedef InputIndexableView::value_type T;
 
             const auto compute_domain = output_view.extent.tile<TileSize>().pad();
-            concurrency::array<T, 1> tile_sums(compute_domain / TileSize, accl_view);
-            concurrency::array_view<T, 1> tile_sums_vw(tile_sums);
+            const scratch_array<T> tile_sums(compute_domain[0] / TileSize, accl_view);
+            concurrency::array_view<T, 1> tile_sums_vw = tile_sums.view();
 
             // Warp A: Run this on Warp accelerators to ensure that the tile_results_vw to contain the correct values.
             // Equivalent to: tile_sums_vw[tidx.tile[0]] = current_value;
 
             if (accl_view.accelerator.device_path == accelerator::direct3d_warp)
             {
-                concurrency::parallel_for_each(accl_view, tile_sums_vw.extent, [=](concurrency::index<1> idx) restrict(amp)
+                _details::parallel_for_each(accl_view, tile_sums_vw.extent, [=](concurrency::index<1> idx) restrict(amp)
                 {
                     tile_sums_vw[idx] = (_Mode == scan_mode::inclusive) ? T() : input_view[last_index_in_tile<TileSize>(idx[0], input_view.extent[0])];
                 });
@@ -320,7 +1118,7 @@ namespace amp_algorithms
 
             // 1 & 2. Scan all tiles and store results in tile_results.
 
-            concurrency::parallel_for_each(accl_view, compute_domain, [=](concurrency::tiled_index<TileSize> tidx) restrict(amp)
+            _details::parallel_for_each(accl_view, compute_domain, [=](concurrency::tiled_index<TileSize> tidx) restrict(amp)
             {
                 const int gidx = tidx.global[0];
                 const int lidx = tidx.local[0];
@@ -351,7 +1149,7 @@ namespace amp_algorithms
 
             if (accl_view.accelerator.device_path == accelerator::direct3d_warp)
             {
-                concurrency::parallel_for_each(accl_view, tile_sums_vw.extent, [=](concurrency::index<1> idx) restrict(amp)
+                _details::parallel_for_each(accl_view, tile_sums_vw.extent, [=](concurrency::index<1> idx) restrict(amp)
                 {
                     tile_sums_vw[idx] += output_view[last_index_in_tile<TileSize>(idx[0], output_view.extent[0])];
                 });
@@ -365,7 +1163,7 @@ namespace amp_algorithms
             }
             else
             {
-                concurrency::parallel_for_each(accl_view, compute_domain, [=](concurrency::tiled_index<TileSize> tidx) restrict(amp)
+                _details::parallel_for_each(accl_view, compute_domain, [=](concurrency::tiled_index<TileSize> tidx) restrict(amp)
                 {
                     const int gidx = tidx.global[0];
                     const int lidx = tidx.local[0];
@@ -385,7 +1183,7 @@ namespace amp_algorithms
 
             // 4. Add the tile results to the individual results for each tile.
 
-            concurrency::parallel_for_each(accl_view, compute_domain, [=](concurrency::tiled_index<TileSize> tidx) restrict(amp)
+            _details::parallel_for_each(accl_view, compute_domain, [=](concurrency::tiled_index<TileSize> tidx) restrict(amp)
             {
                 const int gidx = tidx.global[0];
 
@@ -573,13 +1371,16 @@ namespace amp_algorithms
             const concurrency::tiled_extent<tile_size> compute_domain = output_view.get_extent().tile<tile_size>().pad();
             const int tile_count = std::max(1u, compute_domain.size() / tile_size);
 
-            concurrency::array<int, 2> per_tile_rdx_offsets(concurrency::extent<2>(tile_count, bin_count), accl_view);
-            concurrency::array<int> global_rdx_offsets(bin_count, accl_view);
-            concurrency::array<int, 1> tile_histograms(concurrency::extent<1>(bin_count * tile_count), accl_view);
+            const scratch_array<int> per_tile_rdx_offsets_buffer(tile_count * bin_count, accl_view);
+            const scratch_array<int> global_rdx_offsets_buffer(bin_count, accl_view);
+            const scratch_array<int> tile_histograms_buffer(bin_count * tile_count, accl_view);
+            const concurrency::array_view<int, 2> per_tile_rdx_offsets = per_tile_rdx_offsets_buffer.view().view_as(concurrency::extent<2>(tile_count, bin_count));
+            concurrency::array_view<int> global_rdx_offsets = global_rdx_offsets_buffer.view();
+            const concurrency::array_view<int> tile_histograms = tile_histograms_buffer.view();
 
-            amp_algorithms::fill(accl_view, global_rdx_offsets.section(0, bin_count), 0);
+            amp_algorithms::fill(accl_view, global_rdx_offsets, 0);
 
-            concurrency::parallel_for_each(accl_view, compute_domain, [=, &per_tile_rdx_offsets, &global_rdx_offsets, &tile_histograms](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            _details::parallel_for_each(accl_view, compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
             {
                 const int gidx = tidx.global[0];
                 const int tlx = tidx.tile[0];
@@ -630,7 +1431,7 @@ namespace amp_algorithms
                 }
             });
 
-            concurrency::parallel_for_each(accl_view, compute_domain, [=, &global_rdx_offsets, &tile_histograms](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            _details::parallel_for_each(accl_view, compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
             {
                 const int gidx = tidx.global[0];
                 const int idx = tidx.local[0];
@@ -652,9 +1453,9 @@ namespace amp_algorithms
             });
 
             concurrency::array_view<int, 1> tile_histograms_vw(tile_histograms);
-            scan_exclusive(tile_histograms_vw, tile_histograms_vw);
+            scan_exclusive(accl_view, tile_histograms_vw, tile_histograms_vw);
 
-            concurrency::parallel_for_each(accl_view, compute_domain, [=, &per_tile_rdx_offsets, &tile_histograms, &global_rdx_offsets](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            _details::parallel_for_each(accl_view, compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
             {
                 const int gidx = tidx.global[0];
                 const int tlx = tidx.tile[0];
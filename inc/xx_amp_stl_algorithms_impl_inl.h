@@ -21,8 +21,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
+#include <memory>
 #include <numeric>
+#include <vector>
 
 #include <amp_stl_algorithms.h>
 #include <amp_algorithms.h>
@@ -32,7 +35,8 @@ namespace amp_stl_algorithms
     namespace _details
     {
         template<class ConstRandomAccessIterator>
-        concurrency::array_view<typename std::iterator_traits<ConstRandomAccessIterator>::value_type> 
+        typename std::enable_if<!is_lazy_iterator<ConstRandomAccessIterator>::value, 
+            concurrency::array_view<typename std::iterator_traits<ConstRandomAccessIterator>::value_type>>::type
             create_section(ConstRandomAccessIterator iter, typename std::iterator_traits<ConstRandomAccessIterator>::difference_type distance) 
         {
             typedef std::iterator_traits<ConstRandomAccessIterator>::value_type value_type;
@@ -41,10 +45,132 @@ namespace amp_stl_algorithms
             difference_type start = std::distance(begin(base_view), iter);
             return base_view.section(concurrency::index<1>(start), concurrency::extent<1>(distance));
         }		
+
+        // Lazy iterators have no array_view behind them, the kernels evaluate the iterator itself.
+
+        template<class ConstRandomAccessIterator>
+        typename std::enable_if<is_lazy_iterator<ConstRandomAccessIterator>::value, iterator_view<ConstRandomAccessIterator>>::type
+            create_section(ConstRandomAccessIterator iter, typename std::iterator_traits<ConstRandomAccessIterator>::difference_type distance) 
+        {
+            return iterator_view<ConstRandomAccessIterator>(iter, static_cast<int>(distance));
+        }
+
+        // Host pointer to the elements of an array_view range, used by the host dispatch paths, or nullptr when 
+        // the range's data source is not in host memory and reading it on the host would need a copy. Lazy 
+        // iterators have no storage and always run on the accelerator.
+
+        template<class ConstRandomAccessIterator>
+        typename std::enable_if<!is_lazy_iterator<ConstRandomAccessIterator>::value, typename std::iterator_traits<ConstRandomAccessIterator>::value_type*>::type
+            host_data(ConstRandomAccessIterator iter, typename std::iterator_traits<ConstRandomAccessIterator>::difference_type distance) 
+        {
+            const auto section = create_section(iter, distance);
+            return amp_algorithms::_details::is_host_resident(section) ? section.data() : nullptr;
+        }
+
+        template<class ConstRandomAccessIterator>
+        typename std::enable_if<is_lazy_iterator<ConstRandomAccessIterator>::value, typename std::iterator_traits<ConstRandomAccessIterator>::value_type*>::type
+            host_data(ConstRandomAccessIterator, typename std::iterator_traits<ConstRandomAccessIterator>::difference_type) 
+        {
+            return nullptr;
+        }
+
+        // The execution policy overloads running on a thread form a stack of target_view_scope objects, linked 
+        // from the innermost one through a thread local pointer, so looking up the pinned view takes no lock. A 
+        // scope without a view (par, par_unseq) hands the choice back to the runtime for nested calls.
+
+        class target_view_scope;
+
+        inline const target_view_scope*& innermost_target_view_scope()
+        {
+            static __declspec(thread) const target_view_scope* innermost = nullptr;
+            return innermost;
+        }
+
+        // Pins the calling thread to the policy's accelerator_view for the lifetime of the scope.
+
+        class target_view_scope
+        {
+        public:
+            explicit target_view_scope(const execution::execution_policy& policy) : 
+                m_view(policy.is_pinned() ? new concurrency::accelerator_view(policy.accl_view()) : nullptr), 
+                m_outer(innermost_target_view_scope())
+            {
+                innermost_target_view_scope() = this;
+            }
+
+            ~target_view_scope()
+            {
+                innermost_target_view_scope() = m_outer;
+            }
+
+            const concurrency::accelerator_view* view() const
+            {
+                return m_view.get();
+            }
+
+        private:
+            target_view_scope(const target_view_scope&);
+            target_view_scope& operator=(const target_view_scope&);
+
+            const std::unique_ptr<const concurrency::accelerator_view> m_view;
+            const target_view_scope* const m_outer;
+        };
+
+        inline const concurrency::accelerator_view* pinned_view()
+        {
+            const target_view_scope* const scope = innermost_target_view_scope();
+            return scope ? scope->view() : nullptr;
+        }
+
+        // The accelerator_view that algorithm kernels run on.
+
+        inline concurrency::accelerator_view target_view()
+        {
+            const auto view = pinned_view();
+            return view ? *view : amp_algorithms::_details::auto_select_target();
+        }
+
+        // The accelerator_view that algorithm temporaries are allocated on. Arrays cannot be allocated on the 
+        // auto selection view so this falls back to the default accelerator.
+
+        inline concurrency::accelerator_view scratch_view()
+        {
+            const auto view = pinned_view();
+            return view ? *view : concurrency::accelerator().default_view;
+        }
+
+        // Copies a section to the destination, lazy sections are evaluated by a kernel.
+
+        template<typename T, typename RandomAccessIterator>
+        void copy_section(const concurrency::array_view<T>& src_view, RandomAccessIterator dest_first)
+        {
+            amp_algorithms::_details::traced_copy(src_view, dest_first);
+        }
+
+        template<typename Iterator, typename RandomAccessIterator>
+        void copy_section(const iterator_view<Iterator>& src_view, RandomAccessIterator dest_first)
+        {
+            auto dest_view = _details::create_section(dest_first, src_view.extent.size());
+            dest_view.discard_data();
+            amp_algorithms::_details::for_each_index(_details::target_view(), dest_view.extent, [=](concurrency::index<1> idx) restrict(amp)
+            {
+                dest_view[idx] = src_view[idx];
+            });
+        }
+
+        // Reduces load_op(0) ... load_op(element_count - 1) without materializing the mapped values.
+
+        template<typename T, typename IndexFunction, typename BinaryFunction>
+        T transform_reduce(const int element_count, const IndexFunction& load_op, const BinaryFunction& op)
+        {
+            static const int tile_size = 512;
+            return amp_algorithms::_details::transform_reduce<tile_size, 10000, T>(_details::target_view(), element_count, load_op, op);
+        }
     }
 
     // TODO: Get the tests, header and internal implementations into the same logical order.
-    // TODO: Lots of the algorithms that typically do a small amount of work per thread should use tiling to save the runtime overhead of having to do this. 
+    // TODO: Element-wise algorithms run on amp_algorithms::_details::for_each_index(). Others that do a small amount of work per thread 
+    // still launch a thread per element and should also use tiling to save the runtime overhead of having to do this.
 
     //----------------------------------------------------------------------------
     // adjacent_difference
@@ -56,6 +182,7 @@ namespace amp_stl_algorithms
         RandomAccessIterator dest_first,
         BinaryOperation p )
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
         typedef typename std::iterator_traits<ConstRandomAccessIterator>::value_type T;
 
@@ -70,7 +197,7 @@ namespace amp_stl_algorithms
         auto output_view = _details::create_section(dest_first, element_count);
 
         concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(element_count).tile<tile_size>().pad();
-        concurrency::parallel_for_each(compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        amp_algorithms::_details::parallel_for_each(_details::target_view(), compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
         {
             const int gidx = tidx.global[0];
             const int i = tidx.local[0];
@@ -124,6 +251,7 @@ namespace amp_stl_algorithms
     template<typename ConstRandomAccessIterator, typename UnaryPredicate, typename OutputIterator>
     void any_of(ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryPredicate p, OutputIterator dest_first)
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         auto section_view = _details::create_section(dest_first, 1);
         section_view[0] = 0;
         amp_stl_algorithms::for_each_no_return(
@@ -146,10 +274,11 @@ namespace amp_stl_algorithms
     template<typename ConstRandomAccessIterator, typename UnaryPredicate >
     bool any_of(ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryPredicate p )
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         int found_any_storage = 0;
         concurrency::array_view<int> found_any_av(concurrency::extent<1>(1), &found_any_storage);
         amp_stl_algorithms::any_of(first, last, p, amp_stl_algorithms::begin(found_any_av));
-        found_any_av.synchronize();
+        amp_algorithms::_details::traced_synchronize(found_any_av);
         return found_any_storage == 1;
     }
 
@@ -166,6 +295,7 @@ namespace amp_stl_algorithms
     template<typename ConstRandomAccessIterator, typename RandomAccessIterator>
     RandomAccessIterator copy( ConstRandomAccessIterator first,  ConstRandomAccessIterator last, RandomAccessIterator dest_first )
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
         const diff_type element_count = std::distance(first, last);
         if (element_count <= 0)
@@ -173,16 +303,82 @@ namespace amp_stl_algorithms
             return dest_first;
         }
         auto src_view = _details::create_section(first, element_count);
-        concurrency::copy(src_view, dest_first);
+        _details::copy_section(src_view, dest_first);
         return dest_first + element_count;
     }
 
+    namespace _details
+    {
+        // Stream compaction. The flags map holds a 0 or 1 for each input element and has room for at least 
+        // element_count + 1 values, padded to a whole number of tiles. flag_elements() sets the flags from a 
+        // predicate. scan_flags() converts the flags into output positions and returns the number of flagged 
+        // elements. scatter_flagged() then writes each flagged element to its position in the destination.
+
+        template <int tile_size>
+        inline amp_algorithms::_details::scratch_array<unsigned int> create_flags_map(const int element_count)
+        {
+            return amp_algorithms::_details::scratch_array<unsigned int>(concurrency::extent<1>(element_count + 1).tile<tile_size>().pad().size(), 
+                _details::scratch_view());
+        }
+
+        template <int tile_size, typename InputIndexableView, typename UnaryPredicate>
+        void flag_elements(const InputIndexableView& src_view, const concurrency::array_view<unsigned int>& map_vw, const UnaryPredicate& pred, 
+            const int element_count)
+        {
+            concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(element_count).tile<tile_size>().pad();
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), compute_domain,
+                [src_view, map_vw, pred, element_count](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                const int idx = tidx.global[0];
+                map_vw[idx] = (idx < element_count) ? static_cast<unsigned int>(pred(src_view[idx])) : 0;
+            });
+        }
+
+        inline int scan_flags(concurrency::array_view<unsigned int>& map_vw, const int element_count)
+        {
+            amp_algorithms::scan_exclusive(_details::target_view(), map_vw, map_vw);
+
+            unsigned int flagged_count;
+            amp_algorithms::_details::traced_copy(map_vw.section(element_count, 1), stdext::make_checked_array_iterator(&flagged_count, 1));
+            return static_cast<int>(flagged_count);
+        }
+
+        template <int tile_size, typename InputIndexableView, typename OutputIndexableView>
+        void scatter_flagged(const InputIndexableView& src_view, const OutputIndexableView& dest_view, 
+            const concurrency::array_view<unsigned int>& map_vw, const int element_count)
+        {
+            const int map_size = map_vw.extent[0];
+            concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(element_count).tile<tile_size>().pad();
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                const int idx = tidx.global[0];
+                const int i = tidx.local[0];
+                tile_static unsigned local_buffer[tile_size + 1];
+
+                // Use tile memory so that each value is only read once from global memory.
+                local_buffer[i] = map_vw[idx];
+                if (i == (tile_size - 1))
+                {
+                    local_buffer[i + 1] = ((idx + 1) < map_size) ? map_vw[idx + 1] : local_buffer[i];
+                }
+
+                tidx.barrier.wait_with_tile_static_memory_fence();
+
+                if ((local_buffer[i] != local_buffer[i + 1]) && (idx < element_count))
+                {
+                    dest_view[local_buffer[i]] = src_view[idx];
+                }
+            });
+        }
+    } // namespace _details
+
     template<typename ConstRandomAccessIterator, typename RandomAccessIterator, typename UnaryPredicate>
     RandomAccessIterator copy_if(ConstRandomAccessIterator first,  
         ConstRandomAccessIterator last,
         RandomAccessIterator dest_first,
         UnaryPredicate pred)
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
 
         static const int tile_size = 512;
@@ -192,50 +388,57 @@ namespace amp_stl_algorithms
             return dest_first;
         }
         auto src_view = _details::create_section(first, element_count);
-        auto dest_view = _details::create_section(dest_first, element_count);
 
-        auto map_size = concurrency::extent<1>(element_count + 1).tile<tile_size>().pad().size();
-        concurrency::array<unsigned int> map(map_size);
-        concurrency::array_view<unsigned int> map_vw(map);
-        concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(element_count).tile<tile_size>().pad();
-        concurrency::parallel_for_each(compute_domain,
-            [src_view, map_vw, pred, element_count](concurrency::tiled_index<tile_size> tidx) restrict(amp)
-        {
-            const int idx = tidx.global[0];
-            map_vw[idx] = (idx < element_count) ? static_cast<unsigned int>(pred(src_view[idx])) : 0;
-        });
+        const auto map = _details::create_flags_map<tile_size>(element_count);
+        concurrency::array_view<unsigned int> map_vw = map.view();
+        _details::flag_elements<tile_size>(src_view, map_vw, pred, element_count);
 
-        std::vector<unsigned int> map_dbg(map_size);
-        concurrency::copy(map, begin(map_dbg));
+        const int remaining_elements = _details::scan_flags(map_vw, element_count);
+        if (remaining_elements > 0)
+        {
+            auto dest_view = _details::create_section(dest_first, remaining_elements);
+            dest_view.discard_data();
+            _details::scatter_flagged<tile_size>(src_view, dest_view, map_vw, element_count);
+        }
+        return dest_first + remaining_elements;
+    }
 
-        amp_algorithms::scan_exclusive(map_vw, map_vw);
-        concurrency::copy(map, begin(map_dbg));
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator, typename UnaryPredicate>
+    concurrency::completion_future copy_if_async(ConstRandomAccessIterator first,  
+        ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first,
+        UnaryPredicate pred,
+        const concurrency::array_view<int>& count_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
 
-        dest_view.discard_data();
-        concurrency::parallel_for_each(compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        static const int tile_size = 512;
+        const auto accl_view = _details::target_view();
+        const diff_type element_count = std::distance(first, last);
+        if (element_count <= 0)
         {
-            const int idx = tidx.global[0];
-            const int i = tidx.local[0];
-            tile_static unsigned local_buffer[tile_size + 1];
-
-            // Use tile memory so that each value is only read once from global memory.
-            local_buffer[i] = map_vw[idx];
-            if (i == (tile_size - 1))
-            {
-                local_buffer[i + 1] = map_vw[idx + 1];
-            }
+            concurrency::array_view<int> first_vw = count_view.section(0, 1);
+            amp_algorithms::fill(accl_view, first_vw, 0);
+            return accl_view.create_marker();
+        }
+        auto src_view = _details::create_section(first, element_count);
 
-            tidx.barrier.wait_with_all_memory_fence();
+        const auto map = _details::create_flags_map<tile_size>(element_count);
+        concurrency::array_view<unsigned int> map_vw = map.view();
+        _details::flag_elements<tile_size>(src_view, map_vw, pred, element_count);
+        amp_algorithms::scan_exclusive(accl_view, map_vw, map_vw);
 
-            if ((local_buffer[i] != local_buffer[i + 1]) && (idx < element_count))
-            {
-                dest_view[map_vw[idx]] = src_view[idx];
-            }
+        // The number of flagged elements is only known on the accelerator, so the whole destination range is 
+        // mapped and the count is written by a kernel rather than read back.
+        auto dest_view = _details::create_section(dest_first, element_count);
+        _details::scatter_flagged<tile_size>(src_view, dest_view, map_vw, element_count);
+        const int count = static_cast<int>(element_count);
+        amp_algorithms::_details::for_each_index(accl_view, 1, [=](const int) restrict(amp)
+        {
+            count_view[0] = static_cast<int>(map_vw[count]);
         });
-
-        int remaining_elements;
-        concurrency::copy(map_vw.section(element_count, 1), stdext::make_checked_array_iterator(&remaining_elements, 1));
-        return dest_first + remaining_elements;
+        return accl_view.create_marker();
     }
 
     template<typename ConstRandomAccessIterator, typename Size, typename RandomAccessIterator>
@@ -253,6 +456,18 @@ namespace amp_stl_algorithms
     typename std::iterator_traits<ConstRandomAccessIterator>::difference_type
         count( ConstRandomAccessIterator first, ConstRandomAccessIterator last, const T &value )
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        const auto element_count = std::distance(first, last);
+        if (!_details::is_lazy_iterator<ConstRandomAccessIterator>::value && 
+            amp_algorithms::_details::use_host_dispatch(amp_algorithms::host_dispatch_algorithm::count, static_cast<int>(element_count)))
+        {
+            const auto data = _details::host_data(first, element_count);
+            if (data != nullptr)
+            {
+                return std::count(data, data + element_count, value);
+            }
+        }
+
         return amp_stl_algorithms::count_if(first, last, [value] (const decltype(*first)& cur_val) restrict(amp) 
         { 
             return cur_val == value; 
@@ -264,6 +479,7 @@ namespace amp_stl_algorithms
     typename std::iterator_traits<ConstRandomAccessIterator>::difference_type
         count_if( ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryPredicate p )
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
         const diff_type element_count = std::distance(first, last);
         if (element_count <= 0)
@@ -271,35 +487,35 @@ namespace amp_stl_algorithms
             return 0;
         }
 
-        diff_type count = 0;
-        concurrency::array_view<diff_type> count_av(1, &count);
-
         auto section_view = _details::create_section(first, element_count);
 
-        // TODO: Seems the global memory access isn't coherent. Can it be improved.
-        // TODO: Would a reduction be more efficient than using an atomic operation here?
-        const int num_threads = std::min(element_count, 10 * 1024);
-        concurrency::parallel_for_each(concurrency::extent<1>(num_threads), 
-            [num_threads, section_view, element_count, p, count_av] (concurrency::index<1> idx) restrict (amp) 
+        return _details::transform_reduce<int>(static_cast<int>(element_count), [=](const int idx) restrict(amp) 
+        { 
+            return p(section_view[idx]) ? 1 : 0; 
+        }, 
+        amp_algorithms::plus<int>());
+    }
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    concurrency::completion_future count_if_async(ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryPredicate p, 
+        const concurrency::array_view<int>& count_view)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
+        static const int tile_size = 512;
+        const auto accl_view = _details::target_view();
+        const diff_type element_count = std::distance(first, last);
+        if (element_count <= 0)
         {
-            int tid = idx[0];
-            diff_type local_count = 0;
-            for (diff_type i = tid; i < element_count; i += num_threads)
-            {
-                if (p(section_view(i)))
-                {
-                    local_count++;
-                }
-            }
-            if (local_count > 0)
-            {
-                concurrency::atomic_fetch_add(&count_av(0), local_count);
-            }
+            concurrency::array_view<int> first_vw = count_view.section(0, 1);
+            amp_algorithms::fill(accl_view, first_vw, 0);
+            return accl_view.create_marker();
         }
-        );
 
-        count_av.synchronize();
-        return count;
+        auto section_view = _details::create_section(first, element_count);
+        amp_algorithms::_details::transform_reduce_async<tile_size, 10000, int>(accl_view, static_cast<int>(element_count), 
+            [=](const int idx) restrict(amp) { return p(section_view[idx]) ? 1 : 0; }, amp_algorithms::plus<int>(), count_view);
+        return accl_view.create_marker();
     }
 
     //----------------------------------------------------------------------------
@@ -312,6 +528,7 @@ namespace amp_stl_algorithms
         ConstRandomAccessIterator2 first2, 
         BinaryPredicate p )
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         typedef std::iterator_traits<ConstRandomAccessIterator1>::difference_type diff_type;
         diff_type element_count = std::distance(first1, last1);
         if (element_count <= 0) 
@@ -329,7 +546,7 @@ namespace amp_stl_algorithms
         // TODO: Seems the global memory access isn't coherent. Can it be improved.
         // TODO: Would a reduction be more efficient than using an atomic operation here?
         const int num_threads = std::min(element_count, 10 * 1024);
-        concurrency::parallel_for_each(tiled_extent<tile_size>(concurrency::extent<1>(num_threads)).pad(),
+        amp_algorithms::_details::parallel_for_each(_details::target_view(), tiled_extent<tile_size>(concurrency::extent<1>(num_threads)).pad(),
             [num_threads, section1_view, section2_view, element_count, p, unequal_count_av] (concurrency::tiled_index<tile_size> tidx) restrict (amp) 
         {
             int idx = tidx.global[0];
@@ -380,6 +597,7 @@ namespace amp_stl_algorithms
     template<typename ConstRandomAccessIterator, typename UnaryPredicate>
     ConstRandomAccessIterator find_if(ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryPredicate p )
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         typedef std::iterator_traits<ConstRandomAccessIterator>::difference_type difference_type;
 
         difference_type element_count = std::distance(first, last);
@@ -393,7 +611,7 @@ namespace amp_stl_algorithms
 
         auto section_view = _details::create_section(first, element_count);
 
-        concurrency::parallel_for_each(concurrency::extent<1>(element_count), [=] (concurrency::index<1> idx) restrict(amp) {
+        amp_algorithms::_details::parallel_for_each(_details::target_view(), concurrency::extent<1>(element_count), [=] (concurrency::index<1> idx) restrict(amp) {
             int i = idx[0];
             if (p(section_view[idx]))
             {
@@ -401,7 +619,7 @@ namespace amp_stl_algorithms
             }
         });
 
-        result_position_av.synchronize();
+        amp_algorithms::_details::traced_synchronize(result_position_av);
         return first + result_position;
     }
 
@@ -415,6 +633,18 @@ namespace amp_stl_algorithms
     template<typename ConstRandomAccessIterator, typename T>
     ConstRandomAccessIterator find( ConstRandomAccessIterator first, ConstRandomAccessIterator last, const T& value )
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        const auto element_count = std::distance(first, last);
+        if (!_details::is_lazy_iterator<ConstRandomAccessIterator>::value && 
+            amp_algorithms::_details::use_host_dispatch(amp_algorithms::host_dispatch_algorithm::find, static_cast<int>(element_count)))
+        {
+            const auto data = _details::host_data(first, element_count);
+            if (data != nullptr)
+            {
+                return first + std::distance(data, std::find(data, data + element_count, value));
+            }
+        }
+
         return amp_stl_algorithms::find_if(first, last, [=] (const decltype(*first)& curr_val) restrict(amp) {
             return curr_val == value;
         });
@@ -434,7 +664,7 @@ namespace amp_stl_algorithms
             concurrency::array_view<int> last_sorted_idx_av(1, &last_sorted_idx);
 
             concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(element_count).tile<tile_size>().pad();
-            concurrency::parallel_for_each(compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
             {
                 const int idx = tidx.global[0];
                 const int i = tidx.local[0];
@@ -454,7 +684,7 @@ namespace amp_stl_algorithms
                 }
             });
 
-            last_sorted_idx_av.synchronize();
+            amp_algorithms::_details::traced_synchronize(last_sorted_idx_av);
             return first + last_sorted_idx_av[0];
         }
     }; // namespace _details
@@ -495,7 +725,7 @@ namespace amp_stl_algorithms
         }
 
         auto section_view = _details::create_section(first, element_count);
-        concurrency::parallel_for_each(concurrency::extent<1>(element_count), [f,section_view] (concurrency::index<1> idx) restrict(amp)
+        amp_algorithms::_details::for_each_index(_details::target_view(), section_view.extent, [f,section_view] (concurrency::index<1> idx) restrict(amp)
         {
             f(section_view[idx]);
         });
@@ -505,12 +735,13 @@ namespace amp_stl_algorithms
     template< typename ConstRandomAccessIterator, typename UnaryFunction >
     UnaryFunction for_each( ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryFunction f )
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         concurrency::array_view<UnaryFunction> functor_av(concurrency::extent<1>(1), &f);
         for_each_no_return(first, last,[functor_av] (const decltype(*first)& val) restrict (amp)
         {
             functor_av(0)(val);
         });
-        functor_av.synchronize();
+        amp_algorithms::_details::traced_synchronize(functor_av);
         return f;
     }
 
@@ -525,12 +756,13 @@ namespace amp_stl_algorithms
     template<typename RandomAccessIterator, typename Size, typename Generator>
     RandomAccessIterator generate_n(RandomAccessIterator first, Size count, Generator g)
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         if (count <= 0) 
         {
             return first;
         }
         auto section_view = _details::create_section(first, count);
-        concurrency::parallel_for_each(section_view.extent, [g,section_view] (concurrency::index<1> idx) restrict(amp) 
+        amp_algorithms::_details::for_each_index(_details::target_view(), section_view.extent, [g,section_view] (concurrency::index<1> idx) restrict(amp) 
         {
             section_view[idx] = g();
         });
@@ -548,593 +780,2246 @@ namespace amp_stl_algorithms
     //----------------------------------------------------------------------------
     // includes
     //----------------------------------------------------------------------------
+    //
+    // includes() and the set_* algorithms share a merge path implementation. The merge of the two
+    // sorted input ranges is split into equal length chunks of the merge path, one per thread. Each
+    // thread walks its chunk serially and decides which elements the set operation emits. The first
+    // pass counts the emitted elements per thread, these are scanned to give per-thread output offsets
+    // and the second pass writes the results. This means the output size is known exactly.
+    //
+    // Ties are resolved in favor of the first range so all elements equal to a value in the first range
+    // are visited before the equal elements in the second range. The k-th equal element in one range
+    // is paired with the k-th equal element in the other. Pairing only needs the element's rank within
+    // its run of equal values, so a thread can test any element in constant time regardless of where
+    // its chunk starts.
+    //
+    // References:
+    //
+    // "GPU Merge Path - A GPU Merging Algorithm" http://www.cc.gatech.edu/~bader/papers/GPUMergePath-ICS2012.pdf
 
-    //----------------------------------------------------------------------------
-    // inner_product
-    //----------------------------------------------------------------------------
-    
-    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
-    T inner_product(ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1, ConstRandomAccessIterator2 first2, const T value,
-        const BinaryOperation1& binary_op1, const BinaryOperation2& binary_op2)
+    namespace _details
     {
-        typedef std::iterator_traits<ConstRandomAccessIterator1>::difference_type difference_type;
-        difference_type element_count = std::distance(first1, last1);
-        if (element_count <= 0)
+        enum class set_operation_type : int
         {
-            return value;
-        }
-        auto section1_view = _details::create_section(first1, element_count);
-        auto section2_view = _details::create_section(first2, element_count);
+            set_union = 0,
+            set_intersection = 1,
+            set_difference = 2,
+            set_symmetric_difference = 3,
+            includes = 4
+        };
 
-        concurrency::array<T> map(element_count);
-        concurrency::array_view<T> map_vw(map);
-        map_vw.discard_data();
-        concurrency::parallel_for_each(map_vw.extent, [=](concurrency::index<1> idx) restrict(amp)
+        static const int set_operation_tile_size = 256;
+        static const int set_operation_items_per_thread = 16;
+
+        // Returns the first position in [first, last) that is not less than value.
+
+        template <typename InputIndexableView, typename T, typename Compare>
+        inline int lower_bound_serial(const InputIndexableView& view, int first, int last, const T& value, const Compare& comp) restrict(cpu, amp)
         {
-            map_vw[idx] = binary_op2(section1_view[idx], section2_view[idx]);
-        });
-        map_vw.synchronize();
-        return binary_op1(value, amp_algorithms::reduce(map_vw, binary_op1));
-    }
+            while (first < last)
+            {
+                const int mid = first + ((last - first) >> 1);
+                if (comp(view[mid], value))
+                {
+                    first = mid + 1;
+                }
+                else
+                {
+                    last = mid;
+                }
+            }
+            return first;
+        }
 
-    //----------------------------------------------------------------------------
-    // iota
-    //----------------------------------------------------------------------------
+        // Returns the number of elements from the first range that precede the diag-th element of the merged ranges.
 
-    template<typename RandomAccessIterator, typename T>
-    void iota( RandomAccessIterator first, RandomAccessIterator last, T value)
-    {
-        typedef std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
-        const int tile_size = 512;
+        template <typename InputIndexableView1, typename InputIndexableView2, typename Compare>
+        inline int merge_path(const InputIndexableView1& view1, const int count1, const InputIndexableView2& view2, const int count2, 
+            const int diag, const Compare& comp) restrict(cpu, amp)
+        {
+            int first = amp_algorithms::max<int>()(0, diag - count2);
+            int last = amp_algorithms::min<int>()(diag, count1);
+            while (first < last)
+            {
+                const int mid = (first + last) >> 1;
+                if (!comp(view2[diag - 1 - mid], view1[mid]))
+                {
+                    first = mid + 1;
+                }
+                else
+                {
+                    last = mid;
+                }
+            }
+            return first;
+        }
 
-        difference_type element_count = std::distance(first, last);
-        if (element_count <= 0) 
+        template <set_operation_type Op>
+        inline bool set_operation_emits_first(const bool matched) restrict(cpu, amp)
         {
-            return;
+            return (Op == set_operation_type::set_union) || 
+                ((Op == set_operation_type::set_intersection) ? matched : 
+                ((Op == set_operation_type::set_difference || Op == set_operation_type::set_symmetric_difference) && !matched));
         }
-        // TODO: This looks like it is in violation with the standard, which requires that the value needs to support 
-        //       only ++value. i.e. the default ctor or subtraction, multiplication might not be available. We should 
-        //       consider if there is a better alternative.
-        auto inc = T();
-        inc = ++inc - T();
-        auto section_view = _details::create_section(first, element_count);
 
-        concurrency::parallel_for_each(concurrency::tiled_extent<tile_size>(section_view.extent).pad(), [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        template <set_operation_type Op>
+        inline bool set_operation_emits_second(const bool matched) restrict(cpu, amp)
         {
-            int idx = tidx.global[0];
-            section_view[idx] = value + (T(idx) * inc);  // Hum... Is this numerically equivalent to incrementing?
-        });
-    }
+            return !matched && (Op == set_operation_type::set_union || Op == set_operation_type::set_symmetric_difference || 
+                Op == set_operation_type::includes);
+        }
 
-    //----------------------------------------------------------------------------
-    // lexographical_compare
-    //----------------------------------------------------------------------------
+        class set_operation_counter
+        {
+        public:
+            set_operation_counter() restrict(cpu, amp) : m_count(0) { }
 
-    //----------------------------------------------------------------------------
-    // lower_bound, upper_bound
-    //----------------------------------------------------------------------------
+            template <typename T>
+            void operator()(const T&) restrict(cpu, amp)
+            {
+                ++m_count;
+            }
 
-    //----------------------------------------------------------------------------
-    // merge, inplace_merge
-    //----------------------------------------------------------------------------
+            int count() const restrict(cpu, amp)
+            {
+                return m_count;
+            }
 
-    //----------------------------------------------------------------------------
-    // max_element, min_element, minmax_element
-    //----------------------------------------------------------------------------
+        private:
+            int m_count;
+        };
 
-    template<typename ConstRandomAccessIterator>
-    ConstRandomAccessIterator min_element(ConstRandomAccessIterator first, ConstRandomAccessIterator last)
-    {
-        typedef typename std::remove_const < typename std::iterator_traits<ConstRandomAccessIterator>::value_type>::type T;
-        return amp_stl_algorithms::max_element(first, last, amp_algorithms::greater<T>());
-    }
+        template <typename OutputIndexableView>
+        class set_operation_writer
+        {
+        public:
+            set_operation_writer(const OutputIndexableView& dest_view, const int position) restrict(cpu, amp) 
+                : m_dest_view(dest_view), m_position(position) { }
 
-    template<typename ConstRandomAccessIterator, typename Compare>
-    ConstRandomAccessIterator min_element(ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp)
-    {
-        typedef typename std::remove_const < typename std::iterator_traits<ConstRandomAccessIterator>::value_type>::type T;
-        return amp_stl_algorithms::max_element(first, last, amp_algorithms::not2(comp));
-    }
+            template <typename T>
+            void operator()(const T& value) restrict(cpu, amp)
+            {
+                m_dest_view[m_position++] = value;
+            }
 
-    template<typename ConstRandomAccessIterator, typename Compare>
-    ConstRandomAccessIterator max_element(ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp)
-    {
-        typedef typename std::remove_const < typename std::iterator_traits<ConstRandomAccessIterator>::value_type>::type T;
-        typedef std::iterator_traits<ConstRandomAccessIterator>::difference_type difference_type;
+        private:
+            OutputIndexableView m_dest_view;
+            int m_position;
+        };
 
-        difference_type element_count = std::distance(first, last);
-        if (element_count <= 0)
+        // Walk the merge path from diagonal diag_first to diag_last, starting at (idx1, idx2), passing each emitted element to output.
+
+        template <set_operation_type Op, typename InputIndexableView1, typename InputIndexableView2, typename Compare, typename Output>
+        inline void set_operation_serial(const InputIndexableView1& view1, const int count1, const InputIndexableView2& view2, const int count2, 
+            int idx1, const int diag_first, const int diag_last, const Compare& comp, Output& output) restrict(cpu, amp)
         {
-            return first;
+            int idx2 = diag_first - idx1;
+
+            // Rank of the current element of each range within its run of equal values.
+            int rank1 = (idx1 < count1) ? (idx1 - lower_bound_serial(view1, 0, idx1, view1[idx1], comp)) : 0;
+            int rank2 = (idx2 < count2) ? (idx2 - lower_bound_serial(view2, 0, idx2, view2[idx2], comp)) : 0;
+
+            for (int diag = diag_first; diag < diag_last; ++diag)
+            {
+                if ((idx2 >= count2) || ((idx1 < count1) && !comp(view2[idx2], view1[idx1])))
+                {
+                    // All elements of the second range less than view1[idx1] have been visited, any equal ones start at idx2.
+                    const bool matched = ((idx2 + rank1) < count2) && !comp(view1[idx1], view2[idx2 + rank1]);
+                    if (set_operation_emits_first<Op>(matched))
+                    {
+                        output(view1[idx1]);
+                    }
+                    ++idx1;
+                    rank1 = ((idx1 < count1) && !comp(view1[idx1 - 1], view1[idx1])) ? (rank1 + 1) : 0;
+                }
+                else
+                {
+                    // All elements of the first range equal to view2[idx2] have been visited and end at idx1 - 1.
+                    const bool matched = ((idx1 - 1 - rank2) >= 0) && !comp(view1[idx1 - 1 - rank2], view2[idx2]);
+                    if (set_operation_emits_second<Op>(matched))
+                    {
+                        output(view2[idx2]);
+                    }
+                    ++idx2;
+                    rank2 = ((idx2 < count2) && !comp(view2[idx2 - 1], view2[idx2])) ? (rank2 + 1) : 0;
+                }
+            }
         }
-        auto input_view = _details::create_section(first, element_count);
 
-        // Approach 1: Compare values in input_view in global memory but return the index of the largest element.
-        
-        //auto map = concurrency::array<int, 1>(element_count);
-        //auto map_vw = map.section(0, element_count);
-        //amp_stl_algorithms::iota(begin(map_vw), end(map_vw), 0);
+        // Count pass. On return partitions_vw holds the merge path partition for each thread and offsets_vw the 
+        // exclusive scan of the per-thread output counts. Returns the total number of elements emitted.
+
+        template <set_operation_type Op, typename InputIndexableView1, typename InputIndexableView2, typename Compare>
+        int set_operation_count(const InputIndexableView1& view1, const InputIndexableView2& view2, 
+            concurrency::array_view<int>& partitions_vw, concurrency::array_view<unsigned int>& offsets_vw, const Compare& comp)
+        {
+            static const int tile_size = set_operation_tile_size;
+            static const int items_per_thread = set_operation_items_per_thread;
 
-        //auto r = amp_stl_algorithms::reduce(begin(map_vw), end(map_vw), 0, [=](int a, int b) restrict(amp, cpu)
-        //{
-        //    return comp(input_view[a], input_view[b]) ? b : a;
-        //});
-        //return first + r;
+            const int count1 = view1.extent[0];
+            const int count2 = view2.extent[0];
+            const int diag_count = count1 + count2;
+            const int thread_count = partitions_vw.extent[0] - 1;
 
-        // Approach 2: Create an array of index, value pair<>. This may be faster as it allows reduce() to use tile memory.
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), partitions_vw.extent, [=](concurrency::index<1> idx) restrict(amp)
+            {
+                const int diag = amp_algorithms::min<int>()(idx[0] * items_per_thread, diag_count);
+                partitions_vw[idx] = merge_path(view1, count1, view2, count2, diag, comp);
+            });
 
-        typedef amp_stl_algorithms::pair<int, T> pair_type;
-        auto map = concurrency::array<pair_type, 1>(element_count);
-        auto map_vw = map.section(0, element_count);
+            concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(thread_count).tile<tile_size>().pad();
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                const int gidx = tidx.global[0];
+                set_operation_counter counter;
+                if (gidx < thread_count)
+                {
+                    const int diag_first = gidx * items_per_thread;
+                    const int diag_last = amp_algorithms::min<int>()(diag_first + items_per_thread, diag_count);
+                    set_operation_serial<Op>(view1, count1, view2, count2, partitions_vw[gidx], diag_first, diag_last, comp, counter);
+                }
+                offsets_vw[gidx] = counter.count();
+            });
 
-        concurrency::parallel_for_each(map_vw.extent, [=](concurrency::index<1> idx) restrict(amp, cpu) 
+            amp_algorithms::scan_exclusive(_details::target_view(), offsets_vw, offsets_vw);
+
+            unsigned int total;
+            amp_algorithms::_details::traced_copy(offsets_vw.section(thread_count, 1), stdext::make_checked_array_iterator(&total, 1));
+            return static_cast<int>(total);
+        }
+
+        template <set_operation_type Op, typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator, typename Compare>
+        RandomAccessIterator set_operation(ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+            ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator dest_first, Compare comp)
         {
-            map_vw[idx] = pair_type(idx[0], input_view[idx]);
-        });
+            typedef typename std::iterator_traits<ConstRandomAccessIterator1>::difference_type diff_type;
+            static const int tile_size = set_operation_tile_size;
+            static const int items_per_thread = set_operation_items_per_thread;
+
+            const diff_type count1 = std::distance(first1, last1);
+            const diff_type count2 = std::distance(first2, last2);
+
+            // Empty ranges can't be used to create array_view sections, so handle these up front.
+            if (count1 <= 0)
+            {
+                return (Op == set_operation_type::set_union || Op == set_operation_type::set_symmetric_difference) ? 
+                    amp_stl_algorithms::copy(first2, last2, dest_first) : dest_first;
+            }
+            if (count2 <= 0)
+            {
+                return (Op == set_operation_type::set_intersection) ? dest_first : amp_stl_algorithms::copy(first1, last1, dest_first);
+            }
+
+            auto section1_view = _details::create_section(first1, count1);
+            auto section2_view = _details::create_section(first2, count2);
+
+            const int diag_count = static_cast<int>(count1 + count2);
+            const int thread_count = (diag_count + items_per_thread - 1) / items_per_thread;
+
+            const amp_algorithms::_details::scratch_array<int> partitions(thread_count + 1, _details::scratch_view());
+            concurrency::array_view<int> partitions_vw = partitions.view();
+            const amp_algorithms::_details::scratch_array<unsigned int> offsets(concurrency::extent<1>(thread_count + 1).tile<tile_size>().pad().size(), _details::scratch_view());
+            concurrency::array_view<unsigned int> offsets_vw = offsets.view();
+
+            const int total = set_operation_count<Op>(section1_view, section2_view, partitions_vw, offsets_vw, comp);
+            if (total <= 0)
+            {
+                return dest_first;
+            }
 
-        pair_type r1 = amp_stl_algorithms::reduce(begin(map_vw), end(map_vw), pair_type(0, T()), [=](pair_type a, pair_type b) restrict(amp, cpu)
+            auto dest_view = _details::create_section(dest_first, total);
+            dest_view.discard_data();
+            concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(thread_count).tile<tile_size>().pad();
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                const int gidx = tidx.global[0];
+                if (gidx < thread_count)
+                {
+                    const int diag_first = gidx * items_per_thread;
+                    const int diag_last = amp_algorithms::min<int>()(diag_first + items_per_thread, diag_count);
+                    set_operation_writer<decltype(dest_view)> writer(dest_view, offsets_vw[gidx]);
+                    set_operation_serial<Op>(section1_view, count1, section2_view, count2, partitions_vw[gidx], diag_first, diag_last, comp, writer);
+                }
+            });
+
+            return dest_first + total;
+        }
+    } // namespace _details
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename Compare>
+    bool includes(ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2,
+        Compare comp)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<ConstRandomAccessIterator1>::difference_type diff_type;
+        static const int tile_size = _details::set_operation_tile_size;
+        static const int items_per_thread = _details::set_operation_items_per_thread;
+
+        const diff_type count1 = std::distance(first1, last1);
+        const diff_type count2 = std::distance(first2, last2);
+        if (count2 <= 0)
         {
-            return comp(a.second, b.second) ? b : a;
-        });
-        return first + r1.first;
+            return true;
+        }
+        if (count1 < count2)
+        {
+            return false;
+        }
+
+        auto section1_view = _details::create_section(first1, count1);
+        auto section2_view = _details::create_section(first2, count2);
 
-        // TODO: Approach 3: Remove the first p_f_e by adding support for map_reduce to the library.
+        // Count the elements of the second range that are unmatched in the first.
+        const int thread_count = static_cast<int>(count1 + count2 + items_per_thread - 1) / items_per_thread;
+        const amp_algorithms::_details::scratch_array<int> partitions(thread_count + 1, _details::scratch_view());
+        concurrency::array_view<int> partitions_vw = partitions.view();
+        const amp_algorithms::_details::scratch_array<unsigned int> offsets(concurrency::extent<1>(thread_count + 1).tile<tile_size>().pad().size(), _details::scratch_view());
+        concurrency::array_view<unsigned int> offsets_vw = offsets.view();
+
+        return (_details::set_operation_count<_details::set_operation_type::includes>(section1_view, section2_view, partitions_vw, offsets_vw, comp) == 0);
     }
 
-    template<typename ConstRandomAccessIterator>
-    ConstRandomAccessIterator max_element(ConstRandomAccessIterator first, ConstRandomAccessIterator last)
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2>
+    bool includes(ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2)
     {
-        typedef typename std::remove_const < typename std::iterator_traits<ConstRandomAccessIterator>::value_type>::type T;
-        return amp_stl_algorithms::max_element(first, last, amp_algorithms::less<T>());
+        typedef typename std::iterator_traits<ConstRandomAccessIterator1>::value_type T;
+        return amp_stl_algorithms::includes(first1, last1, first2, last2, amp_algorithms::less<T>());
     }
 
     //----------------------------------------------------------------------------
-    // mismatch
+    // inner_product
     //----------------------------------------------------------------------------
+    
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+    T inner_product(ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1, ConstRandomAccessIterator2 first2, const T value,
+        const BinaryOperation1& binary_op1, const BinaryOperation2& binary_op2)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef std::iterator_traits<ConstRandomAccessIterator1>::difference_type difference_type;
+        difference_type element_count = std::distance(first1, last1);
+        if (element_count <= 0)
+        {
+            return value;
+        }
+        auto section1_view = _details::create_section(first1, element_count);
+        auto section2_view = _details::create_section(first2, element_count);
+
+        return binary_op1(value, _details::transform_reduce<T>(static_cast<int>(element_count), [=](const int idx) restrict(amp)
+        {
+            return binary_op2(section1_view[idx], section2_view[idx]);
+        }, 
+        binary_op1));
+    }
 
     //----------------------------------------------------------------------------
-    // move, move_backward
+    // iota
     //----------------------------------------------------------------------------
 
+    template<typename RandomAccessIterator, typename T>
+    void iota( RandomAccessIterator first, RandomAccessIterator last, T value)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+        difference_type element_count = std::distance(first, last);
+        if (element_count <= 0) 
+        {
+            return;
+        }
+        // TODO: This looks like it is in violation with the standard, which requires that the value needs to support 
+        //       only ++value. i.e. the default ctor or subtraction, multiplication might not be available. We should 
+        //       consider if there is a better alternative.
+        auto inc = T();
+        inc = ++inc - T();
+        auto section_view = _details::create_section(first, element_count);
+
+        amp_algorithms::_details::for_each_index(_details::target_view(), element_count, [=](const int idx) restrict(amp)
+        {
+            section_view[idx] = value + (T(idx) * inc);  // Hum... Is this numerically equivalent to incrementing?
+        });
+    }
+
     //----------------------------------------------------------------------------
-    // nth_element
+    // lexographical_compare
     //----------------------------------------------------------------------------
 
     //----------------------------------------------------------------------------
-    // partition, stable_partition, partition_point, is_partitioned
+    // lower_bound, upper_bound
     //----------------------------------------------------------------------------
 
     //----------------------------------------------------------------------------
-    // reduce
+    // merge, inplace_merge
     //----------------------------------------------------------------------------
 
-    template<typename ConstRandomAccessIterator, typename T, typename BinaryOperation>
-    T reduce( ConstRandomAccessIterator first, ConstRandomAccessIterator last, T initial_value, BinaryOperation op )
-    {
-        typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
-        diff_type element_count = std::distance(first, last);
-        auto section_view = _details::create_section(first, element_count);
-
-        return op(initial_value, amp_algorithms::reduce(section_view, op));
-    }
+    //----------------------------------------------------------------------------
+    // max_element, min_element, minmax_element
+    //----------------------------------------------------------------------------
 
-    template<typename ConstRandomAccessIterator, typename T>
-    T reduce( ConstRandomAccessIterator first, ConstRandomAccessIterator last, T initial_value )
+    template<typename ConstRandomAccessIterator>
+    ConstRandomAccessIterator min_element(ConstRandomAccessIterator first, ConstRandomAccessIterator last)
     {
         typedef typename std::remove_const < typename std::iterator_traits<ConstRandomAccessIterator>::value_type>::type T;
-        return amp_stl_algorithms::reduce(first, last, initial_value, amp_algorithms::plus<T>());
+        return amp_stl_algorithms::max_element(first, last, amp_algorithms::greater<T>());
     }
 
-    //----------------------------------------------------------------------------
-    // remove, remove_if, remove_copy, remove_copy_if
-    //----------------------------------------------------------------------------
-
-    template<typename RandomAccessIterator, typename T>
-    RandomAccessIterator remove( RandomAccessIterator first, RandomAccessIterator last, const T& value )
+    template<typename ConstRandomAccessIterator, typename Compare>
+    ConstRandomAccessIterator min_element(ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp)
     {
-        return amp_stl_algorithms::remove_if(first, last, [=](const T& v) restrict(amp) { return (v == value) ? 1 : 0; });
+        typedef typename std::remove_const < typename std::iterator_traits<ConstRandomAccessIterator>::value_type>::type T;
+        return amp_stl_algorithms::max_element(first, last, [comp](const T& a, const T& b) restrict(cpu, amp) { return comp(b, a); });
     }
 
-    // TODO: Is is possible to remove elements in place and save having to copy?
-    template<typename RandomAccessIterator, typename UnaryPredicate>
-    RandomAccessIterator remove_if(RandomAccessIterator first, RandomAccessIterator last, UnaryPredicate pred)
+    template<typename ConstRandomAccessIterator, typename Compare>
+    ConstRandomAccessIterator max_element(ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp)
     {
-        typedef typename std::iterator_traits<RandomAccessIterator>::difference_type diff_type;
-        typedef typename std::iterator_traits<RandomAccessIterator>::value_type T;
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::remove_const < typename std::iterator_traits<ConstRandomAccessIterator>::value_type>::type T;
+        typedef std::iterator_traits<ConstRandomAccessIterator>::difference_type difference_type;
 
-        const diff_type element_count = std::distance(first, last);
+        difference_type element_count = std::distance(first, last);
         if (element_count <= 0)
         {
             return first;
         }
-        auto src_view = _details::create_section(first, element_count);
+        auto input_view = _details::create_section(first, element_count);
 
-        concurrency::array<T> tmp(element_count);
-        concurrency::array_view<T> tmp_view(tmp);
+        // Each (index, value) pair is created as it is loaded into the reduction's tile buffer. Ties are broken on 
+        // the index so that, like std::max_element, the first of several largest elements is returned regardless 
+        // of the order in which the reduction combines them.
 
-        //  Here copy_if() is used with the predicate inverted
-        auto last_element =  amp_stl_algorithms::copy_if(first, last, begin(tmp_view), 
-            [pred](const T& i) restrict(amp)
+        typedef amp_stl_algorithms::pair<int, T> pair_type;
+        pair_type r = _details::transform_reduce<pair_type>(static_cast<int>(element_count), [=](const int idx) restrict(amp)
         {
-            return static_cast<unsigned int>(!pred(i));
-        });
-        const int remaining_elements = static_cast<int>(std::distance(begin(tmp_view), last_element));
-        if (remaining_elements > 0)
+            return pair_type(idx, input_view[idx]);
+        }, 
+        [=](const pair_type& a, const pair_type& b) restrict(amp, cpu) -> pair_type
         {
-            concurrency::copy(tmp_view.section(0, remaining_elements), src_view.section(0, remaining_elements));
-        }
-        return first + remaining_elements;
-    }
-
-    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename T>
-    RandomAccessIterator remove_copy( ConstRandomAccessIterator first,
-        ConstRandomAccessIterator last,
-        RandomAccessIterator dest_first,
-        const T& value )
-    {
-        typedef typename std::iterator_traits<RandomAccessIterator>::value_type T;
-        return amp_stl_algorithms::copy_if(first, last, dest_first, [=](T& v) restrict(amp) { return (v != value); });
+            if (comp(a.second, b.second))
+            {
+                return b;
+            }
+            if (comp(b.second, a.second))
+            {
+                return a;
+            }
+            return (a.first < b.first) ? a : b;
+        });
+        return first + r.first;
     }
 
-    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryPredicate>
-    RandomAccessIterator remove_copy_if( ConstRandomAccessIterator first,
-        ConstRandomAccessIterator last,
-        RandomAccessIterator dest_first,
-        UnaryPredicate p )
+    template<typename ConstRandomAccessIterator>
+    ConstRandomAccessIterator max_element(ConstRandomAccessIterator first, ConstRandomAccessIterator last)
     {
-        typedef typename std::iterator_traits<RandomAccessIterator>::value_type T;
-        return amp_stl_algorithms::copy_if(first, last, dest_first, [=](T& v) restrict(amp) { return !p(v); });
+        typedef typename std::remove_const < typename std::iterator_traits<ConstRandomAccessIterator>::value_type>::type T;
+        return amp_stl_algorithms::max_element(first, last, amp_algorithms::less<T>());
     }
 
-    //----------------------------------------------------------------------------
-    // replace, replace_if, replace_copy, replace_copy_if
-    //----------------------------------------------------------------------------
-
-    template<typename RandomAccessIterator, typename T>
-    void replace( RandomAccessIterator first, 
-        RandomAccessIterator last,
-        const T& old_value, 
-        const T& new_value )
+    namespace _details
     {
-        typedef std::iterator_traits<RandomAccessIterator>::value_type T;
-
-        amp_stl_algorithms::replace_if(first, last, [=](const T& v) restrict(amp) { return (v == old_value); }, new_value);
-    }
+        template <typename T>
+        struct minmax_element_state
+        {
+            int min_index;
+            T min_value;
+            int max_index;
+            T max_value;
+        };
+    } // namespace _details
 
-    template<typename RandomAccessIterator, typename UnaryPredicate, typename T>
-    void replace_if( RandomAccessIterator first, 
-        RandomAccessIterator last,
-        UnaryPredicate p, 
-        const T& new_value )
+    template<typename ConstRandomAccessIterator, typename Compare>
+    std::pair<ConstRandomAccessIterator, ConstRandomAccessIterator>
+        minmax_element(ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp)
     {
-        typedef std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
-        const int tile_size = 512;
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::remove_const < typename std::iterator_traits<ConstRandomAccessIterator>::value_type>::type T;
+        typedef std::iterator_traits<ConstRandomAccessIterator>::difference_type difference_type;
+        typedef _details::minmax_element_state<T> state_type;
 
         difference_type element_count = std::distance(first, last);
-        if (element_count <= 0) 
+        if (element_count <= 0)
         {
-            return;
+            return std::make_pair(first, first);
         }
-        auto src_view = _details::create_section(first, element_count);
+        auto input_view = _details::create_section(first, element_count);
 
-        concurrency::parallel_for_each(concurrency::tiled_extent<tile_size>(src_view.extent).pad(), 
-            [element_count, new_value, src_view, p](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        // Both extremes are tracked in a single pass. Ties for the smallest element keep the lowest index and ties 
+        // for the largest keep the highest, matching std::minmax_element.
+
+        state_type r = _details::transform_reduce<state_type>(static_cast<int>(element_count), [=](const int idx) restrict(amp) -> state_type
         {
-            int idx = tidx.global[0];
-            if ((idx < element_count) && p(src_view[idx]))
-            {
-                src_view[idx] = new_value;
-            }
+            state_type s;
+            s.min_index = s.max_index = idx;
+            s.min_value = s.max_value = input_view[idx];
+            return s;
+        }, 
+        [=](const state_type& a, const state_type& b) restrict(amp, cpu) -> state_type
+        {
+            state_type s;
+            const bool b_is_min = comp(b.min_value, a.min_value) || (!comp(a.min_value, b.min_value) && (b.min_index < a.min_index));
+            s.min_index = b_is_min ? b.min_index : a.min_index;
+            s.min_value = b_is_min ? b.min_value : a.min_value;
+            const bool b_is_max = comp(a.max_value, b.max_value) || (!comp(b.max_value, a.max_value) && (b.max_index > a.max_index));
+            s.max_index = b_is_max ? b.max_index : a.max_index;
+            s.max_value = b_is_max ? b.max_value : a.max_value;
+            return s;
         });
+        return std::make_pair(first + r.min_index, first + r.max_index);
     }
 
-    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename T>
-    RandomAccessIterator replace_copy( ConstRandomAccessIterator first,
-        ConstRandomAccessIterator last,
-        RandomAccessIterator dest_first,
-        const T& old_value,
-        const T& new_value )
+    template<typename ConstRandomAccessIterator>
+    std::pair<ConstRandomAccessIterator, ConstRandomAccessIterator>
+        minmax_element(ConstRandomAccessIterator first, ConstRandomAccessIterator last)
     {
-        return amp_stl_algorithms::replace_copy_if(first, last, dest_first, [=](const T& v) restrict(amp) { return (v == old_value); }, new_value);
+        typedef typename std::remove_const < typename std::iterator_traits<ConstRandomAccessIterator>::value_type>::type T;
+        return amp_stl_algorithms::minmax_element(first, last, amp_algorithms::less<T>());
     }
 
-    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryPredicate, typename T>
-    RandomAccessIterator replace_copy_if( ConstRandomAccessIterator first,
-        ConstRandomAccessIterator last,
-        RandomAccessIterator dest_first,
-        UnaryPredicate p,
-        const T& new_value )
-    {
-        typedef std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
-        const int tile_size = 512;
-
-        difference_type element_count = std::distance(first, last);
-        if (element_count <= 0) 
-        {
-            return dest_first;
-        }
-        auto src_view = _details::create_section(first, element_count);
-        auto dest_view = _details::create_section(dest_first, element_count);
+    //----------------------------------------------------------------------------
+    // mismatch
+    //----------------------------------------------------------------------------
 
-        int last_changed_idx = 0;
-        concurrency::array_view<int> last_changed_idx_av(1, &last_changed_idx);
+    //----------------------------------------------------------------------------
+    // move, move_backward
+    //----------------------------------------------------------------------------
 
-        concurrency::parallel_for_each(concurrency::tiled_extent<tile_size>(src_view.extent).pad(), 
-            [element_count, new_value, src_view, dest_view, last_changed_idx_av, p](concurrency::tiled_index<tile_size> tidx) restrict(amp)
-        {
-            int idx = tidx.global[0];
-            if (idx < element_count)
-            {
-                if (p(src_view[idx]))
-                {
-                    dest_view[idx] = new_value;
-                    concurrency::atomic_fetch_max(&last_changed_idx_av(0), idx + 1);
-                }
-                else
-                {
-                    dest_view[idx] = src_view[idx];
-                }
-            }
-        });
-
-        return dest_first + last_changed_idx_av[0];
-    }
+    //----------------------------------------------------------------------------
+    // nth_element
+    //----------------------------------------------------------------------------
 
     //----------------------------------------------------------------------------
-    // reverse, reverse_copy
+    // partition, stable_partition, partition_point, is_partitioned
     //----------------------------------------------------------------------------
 
-    template<typename RandomAccessIterator>
-    void reverse( RandomAccessIterator first, RandomAccessIterator last )
+    namespace _details
     {
-        typedef typename std::iterator_traits<RandomAccessIterator>::difference_type diff_type;
-        const int tile_size = 512;
+        // Two sided compaction. After scan_flags() map_vw[i] is the number of elements before i that satisfy 
+        // the predicate. Elements that satisfy it are written from the front of the destination and the 
+        // remaining elements are written after them, both in their original order.
 
-        const diff_type element_count = std::distance(first, last);
-        if (element_count <= 1) 
+        template <typename InputIndexableView, typename OutputIndexableView>
+        void scatter_partitioned(const InputIndexableView& src_view, const OutputIndexableView& dest_view, 
+            const concurrency::array_view<unsigned int>& map_vw, const int element_count, const int true_count)
         {
-            return;
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), concurrency::extent<1>(element_count), [=](concurrency::index<1> idx) restrict(amp)
+            {
+                const int i = idx[0];
+                const int true_before = map_vw[i];
+                const int dest_idx = (map_vw[i + 1] != map_vw[i]) ? true_before : (true_count + i - true_before);
+                dest_view[dest_idx] = src_view[idx];
+            });
         }
-        auto src_view = _details::create_section(first, element_count);
-        const int last_element = element_count - 1;
 
-        concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(element_count >> 1);
-        concurrency::parallel_for_each(compute_domain.pad(), [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp) 
+        // Finds the first element that does not satisfy the predicate in a partitioned range. A single tile 
+        // narrows the range by a factor of tile_size on each pass, so only log(element_count) / log(tile_size) 
+        // passes are needed and the predicate is evaluated at most tile_size times per pass.
+
+        template <int tile_size, typename InputIndexableView, typename UnaryPredicate>
+        int partition_point(const InputIndexableView& view, const int element_count, UnaryPredicate p)
         {
-            const int idx = tidx.global[0];
-            if (idx < element_count)
+            int pass_count = 0;
+            for (int length = element_count; length > 0; length = (length + tile_size - 1) / tile_size - 1)
             {
-                amp_stl_algorithms::swap(src_view[idx], src_view[last_element - idx]);
+                ++pass_count;
             }
-        });
-    }
 
-    template<typename ConstRandomAccessIterator, typename RandomAccessIterator>
-    RandomAccessIterator reverse_copy( ConstRandomAccessIterator first, 
-        ConstRandomAccessIterator last, 
-        RandomAccessIterator dest_first)
-    {
-        typedef typename std::iterator_traits<RandomAccessIterator>::difference_type diff_type;
-        const int tile_size = 512;
+            int result = element_count;
+            concurrency::array_view<int> result_av(1, &result);
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), concurrency::extent<1>(tile_size).tile<tile_size>(), 
+                [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                const int i = tidx.local[0];
+                tile_static int range_first;
+                tile_static int range_last;
+                tile_static int lowest_false;
+                if (i == 0)
+                {
+                    range_first = 0;
+                    range_last = element_count;
+                }
 
-        const diff_type element_count = std::distance(first, last);
-        if (element_count <= 0) 
-        {
-            return dest_first;
+                // Invariant: every element before range_first satisfies p and the element at range_last, if 
+                // there is one, does not.
+                for (int pass = 0; pass < pass_count; ++pass)
+                {
+                    tidx.barrier.wait_with_tile_static_memory_fence();
+                    const int first = range_first;
+                    const int last = range_last;
+                    const int step = (last - first + tile_size - 1) / tile_size;
+                    if (i == 0)
+                    {
+                        lowest_false = tile_size;
+                    }
+                    tidx.barrier.wait_with_tile_static_memory_fence();
+
+                    // Each thread tests the last element of its segment of the range.
+                    const int segment_first = first + i * step;
+                    if (segment_first < last)
+                    {
+                        const int probe = amp_algorithms::min<int>()(segment_first + step, last) - 1;
+                        if (!p(view[probe]))
+                        {
+                            concurrency::atomic_fetch_min(&lowest_false, i);
+                        }
+                    }
+                    tidx.barrier.wait_with_tile_static_memory_fence();
+
+                    if (i == 0)
+                    {
+                        const int k = lowest_false;
+                        range_first = amp_algorithms::min<int>()(first + k * step, last);
+                        range_last = (k == tile_size) ? last : amp_algorithms::min<int>()(first + (k + 1) * step, last) - 1;
+                    }
+                }
+                tidx.barrier.wait_with_tile_static_memory_fence();
+
+                if (i == 0)
+                {
+                    result_av[0] = range_first;
+                }
+            });
+
+            amp_algorithms::_details::traced_synchronize(result_av);
+            return result;
         }
-        auto src_view = _details::create_section(first, element_count);
-        auto dest_view = _details::create_section(dest_first, element_count);
-        const int last_element = element_count - 1;
 
-        concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(element_count);
-        concurrency::parallel_for_each(compute_domain.pad(), [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp) 
+        // Searches for an element that satisfies the predicate following one that does not. Each thread 
+        // strides through the range and stops as soon as any thread has found such a pair.
+
+        template <typename InputIndexableView, typename UnaryPredicate>
+        bool is_partitioned(const InputIndexableView& view, const int element_count, UnaryPredicate p)
         {
-            const int idx = tidx.global[0];
-            if (idx < element_count)
+            static const int max_threads = 64 * 1024;
+
+            const int pair_count = element_count - 1;
+            const int thread_count = amp_algorithms::min<int>()(pair_count, max_threads);
+            int found = 0;
+            concurrency::array_view<int> found_av(1, &found);
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), concurrency::extent<1>(thread_count), [=](concurrency::index<1> idx) restrict(amp)
             {
-                dest_view[idx] = src_view[last_element - idx];
-            }
-        });
+                for (int i = idx[0]; i < pair_count; i += thread_count)
+                {
+                    if (found_av[0] != 0)
+                    {
+                        return;
+                    }
+                    if (!p(view[i]) && p(view[i + 1]))
+                    {
+                        found_av[0] = 1;
+                        return;
+                    }
+                }
+            });
 
-        return dest_first + element_count;
-    }
+            amp_algorithms::_details::traced_synchronize(found_av);
+            return (found == 0);
+        }
+    } // namespace _details
 
-    //----------------------------------------------------------------------------
-    // rotate, rotate_copy
-    //----------------------------------------------------------------------------
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    bool is_partitioned( ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryPredicate p )
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
 
-    template<typename ConstRandomAccessIterator, typename RandomAccessIterator>
-    RandomAccessIterator rotate_copy(ConstRandomAccessIterator first,
-        ConstRandomAccessIterator middle,
-        ConstRandomAccessIterator last,
-        RandomAccessIterator dest_first)
+        const diff_type element_count = std::distance(first, last);
+        if (element_count <= 1)
+        {
+            return true;
+        }
+        auto section_view = _details::create_section(first, element_count);
+        return _details::is_partitioned(section_view, element_count, p);
+    }
+
+    template<typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator stable_partition( RandomAccessIterator first, RandomAccessIterator last, UnaryPredicate p )
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         typedef typename std::iterator_traits<RandomAccessIterator>::difference_type diff_type;
-        const diff_type element_count = std::distance(first, last);
-        const diff_type middle_offset = std::distance(first, middle);
+        typedef typename std::iterator_traits<RandomAccessIterator>::value_type T;
 
-        auto src_view = _details::create_section(first, element_count);
-        auto dest_view = _details::create_section(dest_first, element_count);
+        static const int tile_size = 512;
+        const diff_type element_count = std::distance(first, last);
+        if (element_count <= 0)
+        {
+            return first;
+        }
+        auto section_view = _details::create_section(first, element_count);
 
-        concurrency::parallel_for_each(dest_view.extent, [=](concurrency::index<1> idx) restrict(amp)
+        const auto map = _details::create_flags_map<tile_size>(element_count);
+        concurrency::array_view<unsigned int> map_vw = map.view();
+        amp_algorithms::_details::parallel_for_each(_details::target_view(), map_vw.extent, [=](concurrency::index<1> idx) restrict(amp)
         {
-            dest_view[idx] = src_view[(idx + middle_offset) % element_count];
+            map_vw[idx] = (idx[0] < element_count) ? static_cast<unsigned int>(p(section_view[idx])) : 0;
         });
-        return dest_first + element_count;
-    }
-
-    //----------------------------------------------------------------------------
-    // search, search_n, binary_search
-    //----------------------------------------------------------------------------
+        const int true_count = _details::scan_flags(map_vw, element_count);
 
-    //----------------------------------------------------------------------------
-    // set_difference, set_intersection, set_symetric_distance, set_union
-    //----------------------------------------------------------------------------
+        // Both halves are written in a single pass to a temporary. Writing in place would race with reads.
+        const amp_algorithms::_details::scratch_array<T> tmp(element_count, _details::scratch_view());
+        concurrency::array_view<T> tmp_view = tmp.view();
+        tmp_view.discard_data();
+        _details::scatter_partitioned(section_view, tmp_view, map_vw, element_count, true_count);
+        amp_algorithms::_details::traced_copy(tmp_view, section_view);
 
-    //----------------------------------------------------------------------------
-    // shuffle, random_shuffle, 
-    //----------------------------------------------------------------------------
+        return first + true_count;
+    }
 
-    //----------------------------------------------------------------------------
-    // is_sorted, is_sorted_until, sort, partial_sort, partial_sort_copy, stable_sort
-    //----------------------------------------------------------------------------
+    template<typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator partition( RandomAccessIterator first, RandomAccessIterator last, UnaryPredicate p )
+    {
+        return amp_stl_algorithms::stable_partition(first, last, p);
+    }
 
-    template<typename ConstRandomAccessIterator, typename Compare>
-    ConstRandomAccessIterator is_sorted_until( ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp )
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    ConstRandomAccessIterator partition_point( ConstRandomAccessIterator first, ConstRandomAccessIterator last, UnaryPredicate p )
     {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
         typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
-        typedef typename std::iterator_traits<ConstRandomAccessIterator>::value_type T;
 
+        static const int tile_size = 256;
         const diff_type element_count = std::distance(first, last);
-        if (element_count <= 1)
+        if (element_count <= 0)
         {
             return last;
         }
-        return _details::adjacent_find(first, element_count, 
-            [=](const T& a, const T& b) restrict(amp) { return !comp(a, b); }) + 1;
+        auto section_view = _details::create_section(first, element_count);
+        return first + _details::partition_point<tile_size>(section_view, element_count, p);
     }
 
-    template<typename ConstRandomAccessIterator>
-    bool is_sorted( ConstRandomAccessIterator first, ConstRandomAccessIterator last )
-    {
-        typedef typename std::iterator_traits<ConstRandomAccessIterator>::value_type T;
-        return (amp_stl_algorithms::is_sorted_until(first, last, amp_algorithms::less_equal<T>()) == last);
-    }
+    //----------------------------------------------------------------------------
+    // reduce
+    //----------------------------------------------------------------------------
 
-    template<typename ConstRandomAccessIterator, typename Compare>
-    bool is_sorted( ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp )
+    template<typename ConstRandomAccessIterator, typename T, typename BinaryOperation>
+    T reduce( ConstRandomAccessIterator first, ConstRandomAccessIterator last, T initial_value, BinaryOperation op )
     {
-        return (amp_stl_algorithms::is_sorted_until(first, last, comp) == last);
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
+        diff_type element_count = std::distance(first, last);
+        auto section_view = _details::create_section(first, element_count);
+
+        return op(initial_value, amp_algorithms::reduce(_details::target_view(), section_view, op));
     }
 
-    template<typename ConstRandomAccessIterator>
-    ConstRandomAccessIterator is_sorted_until( ConstRandomAccessIterator first, ConstRandomAccessIterator last )
+    template<typename ConstRandomAccessIterator, typename T>
+    T reduce( ConstRandomAccessIterator first, ConstRandomAccessIterator last, T initial_value )
     {
-        typedef typename std::iterator_traits<ConstRandomAccessIterator>::value_type T;
-        return amp_stl_algorithms::is_sorted_until(first, last, amp_algorithms::less_equal<T>());
+        typedef typename std::remove_const < typename std::iterator_traits<ConstRandomAccessIterator>::value_type>::type T;
+        return amp_stl_algorithms::reduce(first, last, initial_value, amp_algorithms::plus<T>());
     }
 
     //----------------------------------------------------------------------------
-    // swap, swap<T, N>, swap_ranges, iter_swap
+    // reduce_by_key
     //----------------------------------------------------------------------------
+    //
+    // Each element is paired with a head count, 1 if it starts a new key and 0 otherwise, and the pairs are 
+    // scanned with the operator (c1, v1) + (c2, v2) = (c1 + c2, (c2 > 0) ? v2 : op(v1, v2)). This is associative 
+    // whenever op is, so a single segmented scan yields both the reduction of each key's values so far and the 
+    // output position of each key. A final pass writes each key's head and the reduction at its last element.
+    //
+    // References:
+    //
+    // "Efficient Parallel Scan Algorithms for GPUs" http://www.gpucomputing.net/sites/default/files/papers/2590/nvr-2008-003.pdf
 
-    template<typename T>
-    void swap( T& a, T& b ) restrict(cpu, amp)
+    namespace _details
     {
-        T tmp = a;
-        a = b;
-        b = tmp;
-    }
+        static const int reduce_by_key_tile_size = 256;
 
-    template<typename T, int N>
-    void swap( T (&a)[N], T (&b)[N]) restrict(cpu, amp)
-    {
-        for (int i = 0; i < N; ++i)
+        // In place inclusive scan of (head count, value) pairs.
+
+        template <int tile_size, typename T, typename BinaryOperation>
+        void segmented_scan_inclusive(const concurrency::array_view<int>& counts_vw, const concurrency::array_view<T>& values_vw, 
+            const BinaryOperation& op)
         {
-            amp_stl_algorithms::swap(a[i], b[i]);
-        }
-    }
+            const int element_count = counts_vw.extent[0];
+            const concurrency::tiled_extent<tile_size> compute_domain = counts_vw.extent.tile<tile_size>().pad();
+            const int tile_count = compute_domain.size() / tile_size;
 
-    template<typename RandomAccessIterator1, typename RandomAccessIterator2>
-    RandomAccessIterator2 swap_ranges(RandomAccessIterator1 first1,
-        RandomAccessIterator1 last1, 
-        RandomAccessIterator2 first2)
+            const amp_algorithms::_details::scratch_array<int> tile_counts(tile_count, _details::scratch_view());
+            concurrency::array_view<int> tile_counts_vw = tile_counts.view();
+            const amp_algorithms::_details::scratch_array<T> tile_values(tile_count, _details::scratch_view());
+            concurrency::array_view<T> tile_values_vw = tile_values.view();
+            tile_counts_vw.discard_data();
+            tile_values_vw.discard_data();
+
+            // 1. Scan each tile and store the tile totals.
+
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                const int gidx = tidx.global[0];
+                const int lidx = tidx.local[0];
+                tile_static int tile_counts_data[tile_size];
+                tile_static T tile_values_data[tile_size];
+
+                tile_counts_data[lidx] = padded_read(counts_vw, gidx);
+                tile_values_data[lidx] = padded_read(values_vw, gidx);
+                tidx.barrier.wait_with_tile_static_memory_fence();
+
+                for (int stride = 1; stride < tile_size; stride *= 2)
+                {
+                    int count = tile_counts_data[lidx];
+                    T value = tile_values_data[lidx];
+                    if (lidx >= stride)
+                    {
+                        value = (count > 0) ? value : op(tile_values_data[lidx - stride], value);
+                        count += tile_counts_data[lidx - stride];
+                    }
+                    tidx.barrier.wait_with_tile_static_memory_fence();
+
+                    tile_counts_data[lidx] = count;
+                    tile_values_data[lidx] = value;
+                    tidx.barrier.wait_with_tile_static_memory_fence();
+                }
+
+                if (gidx < element_count)
+                {
+                    counts_vw[gidx] = tile_counts_data[lidx];
+                    values_vw[gidx] = tile_values_data[lidx];
+                }
+                if (lidx == (tile_size - 1))
+                {
+                    tile_counts_vw[tidx.tile[0]] = tile_counts_data[lidx];
+                    tile_values_vw[tidx.tile[0]] = tile_values_data[lidx];
+                }
+            });
+
+            if (tile_count == 1)
+            {
+                return;
+            }
+
+            // 2. Scan the tile totals.
+
+            segmented_scan_inclusive<tile_size>(tile_counts_vw, tile_values_vw, op);
+
+            // 3. Combine the total of all preceding tiles into each element of the following tiles.
+
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), concurrency::extent<1>(element_count - tile_size), [=](concurrency::index<1> idx) restrict(amp)
+            {
+                const int gidx = idx[0] + tile_size;
+                const int preceding_tile = (gidx / tile_size) - 1;
+                const int count = counts_vw[gidx];
+                if (count == 0)
+                {
+                    values_vw[gidx] = op(tile_values_vw[preceding_tile], values_vw[gidx]);
+                }
+                counts_vw[gidx] = count + tile_counts_vw[preceding_tile];
+            });
+        }
+    } // namespace _details
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryPredicate, typename BinaryOperation>
+    int reduce_by_key( ConstRandomAccessIterator1 keys_first,
+        ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first,
+        RandomAccessIterator1 keys_dest_first,
+        RandomAccessIterator2 values_dest_first,
+        BinaryPredicate p,
+        BinaryOperation op )
     {
-        typedef std::iterator_traits<RandomAccessIterator1>::difference_type difference_type;
-        typedef std::iterator_traits<RandomAccessIterator1>::value_type T;
-        const int tile_size = 512;
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<ConstRandomAccessIterator1>::difference_type diff_type;
+        typedef typename std::remove_const<typename std::iterator_traits<ConstRandomAccessIterator2>::value_type>::type T;
 
-        difference_type element_count = std::distance(first1, last1);
+        const diff_type element_count = std::distance(keys_first, keys_last);
         if (element_count <= 0)
         {
-            return first2;
+            return 0;
         }
-        concurrency::array_view<T> first1_view = _details::create_section(first1, element_count);
-        concurrency::array_view<T> first2_view = _details::create_section(first2, element_count);
+        auto keys_view = _details::create_section(keys_first, element_count);
+        auto values_view = _details::create_section(values_first, element_count);
 
-        concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(element_count >> 1);
-        concurrency::parallel_for_each(compute_domain.pad(), [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp) 
+        const amp_algorithms::_details::scratch_array<int> counts(static_cast<int>(element_count), _details::scratch_view());
+        concurrency::array_view<int> counts_vw = counts.view();
+        const amp_algorithms::_details::scratch_array<T> scanned_values(static_cast<int>(element_count), _details::scratch_view());
+        concurrency::array_view<T> scanned_values_vw = scanned_values.view();
+
+        amp_algorithms::_details::parallel_for_each(_details::target_view(), counts_vw.extent, [=](concurrency::index<1> idx) restrict(amp)
         {
-            const int idx = tidx.global[0];
-            if (idx < element_count)
+            const int i = idx[0];
+            counts_vw[idx] = ((i == 0) || !p(keys_view[i - 1], keys_view[i])) ? 1 : 0;
+            scanned_values_vw[idx] = values_view[idx];
+        });
+
+        _details::segmented_scan_inclusive<_details::reduce_by_key_tile_size>(counts_vw, scanned_values_vw, op);
+
+        int unique_count;
+        amp_algorithms::_details::traced_copy(counts_vw.section(static_cast<int>(element_count) - 1, 1), stdext::make_checked_array_iterator(&unique_count, 1));
+
+        auto keys_dest_view = _details::create_section(keys_dest_first, unique_count);
+        auto values_dest_view = _details::create_section(values_dest_first, unique_count);
+        keys_dest_view.discard_data();
+        values_dest_view.discard_data();
+        amp_algorithms::_details::parallel_for_each(_details::target_view(), counts_vw.extent, [=](concurrency::index<1> idx) restrict(amp)
+        {
+            const int i = idx[0];
+            const int count = counts_vw[i];
+            if ((i == 0) || (counts_vw[i - 1] != count))
             {
-                amp_stl_algorithms::swap(first1_view[idx], first2_view[idx]);
+                keys_dest_view[count - 1] = keys_view[i];
+            }
+            if ((i == (element_count - 1)) || (counts_vw[i + 1] != count))
+            {
+                values_dest_view[count - 1] = scanned_values_vw[i];
             }
         });
 
-        return first2 + element_count;
+        return unique_count;
     }
 
-    template<typename RandomAccessIterator1, typename RandomAccessIterator2>
-    void iter_swap( RandomAccessIterator1 a, RandomAccessIterator2 b ) restrict(cpu, amp)
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryOperation>
+    int reduce_by_key( ConstRandomAccessIterator1 keys_first,
+        ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first,
+        RandomAccessIterator1 keys_dest_first,
+        RandomAccessIterator2 values_dest_first,
+        BinaryOperation op )
     {
-        amp_stl_algorithms::swap(*a, *b);
+        typedef typename std::remove_const<typename std::iterator_traits<ConstRandomAccessIterator1>::value_type>::type Key;
+        return amp_stl_algorithms::reduce_by_key(keys_first, keys_last, values_first, keys_dest_first, values_dest_first, amp_algorithms::equal_to<Key>(), op);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2>
+    int reduce_by_key( ConstRandomAccessIterator1 keys_first,
+        ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first,
+        RandomAccessIterator1 keys_dest_first,
+        RandomAccessIterator2 values_dest_first )
+    {
+        typedef typename std::remove_const<typename std::iterator_traits<ConstRandomAccessIterator2>::value_type>::type T;
+        return amp_stl_algorithms::reduce_by_key(keys_first, keys_last, values_first, keys_dest_first, values_dest_first, amp_algorithms::plus<T>());
     }
 
     //----------------------------------------------------------------------------
-    // transform (Unary)
+    // remove, remove_if, remove_copy, remove_copy_if
     //----------------------------------------------------------------------------
 
-    // The "UnaryFunction" functor needs to be callable as "func(ConstRandomAccessIterator::value_type)".
-    // The functor needs to be blittable and cannot contain any array, array_view, or textures.
-
-    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryFunction>
-    RandomAccessIterator transform( ConstRandomAccessIterator first, 
-        ConstRandomAccessIterator last, 
-        RandomAccessIterator dest_first,
-        UnaryFunction func)
+    template<typename RandomAccessIterator, typename T>
+    RandomAccessIterator remove( RandomAccessIterator first, RandomAccessIterator last, const T& value )
     {
-        typedef std::iterator_traits<ConstRandomAccessIterator>::difference_type difference_type;
-
-        difference_type element_count = std::distance(first, last);
+        return amp_stl_algorithms::remove_if(first, last, [=](const T& v) restrict(amp) { return (v == value) ? 1 : 0; });
+    }
+
+    // TODO: Is is possible to remove elements in place and save having to copy?
+    template<typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator remove_if(RandomAccessIterator first, RandomAccessIterator last, UnaryPredicate pred)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<RandomAccessIterator>::difference_type diff_type;
+        typedef typename std::iterator_traits<RandomAccessIterator>::value_type T;
+
+        const diff_type element_count = std::distance(first, last);
         if (element_count <= 0)
         {
-            return dest_first;
+            return first;
         }
-        // TODO: input view should be const.
-        auto input_view = _details::create_section(first, element_count);
-        auto output_view = _details::create_section(dest_first, element_count);
-        output_view.discard_data();
+        auto src_view = _details::create_section(first, element_count);
 
-        concurrency::parallel_for_each(output_view.extent, [func,input_view,output_view] (concurrency::index<1> idx) restrict(amp) {
-            output_view[idx] = func(input_view[idx]);
+        const amp_algorithms::_details::scratch_array<T> tmp(element_count, _details::scratch_view());
+        concurrency::array_view<T> tmp_view = tmp.view();
+
+        //  Here copy_if() is used with the predicate inverted
+        auto last_element =  amp_stl_algorithms::copy_if(first, last, begin(tmp_view), 
+            [pred](const T& i) restrict(amp)
+        {
+            return static_cast<unsigned int>(!pred(i));
         });
+        const int remaining_elements = static_cast<int>(std::distance(begin(tmp_view), last_element));
+        if (remaining_elements > 0)
+        {
+            amp_algorithms::_details::traced_copy(tmp_view.section(0, remaining_elements), src_view.section(0, remaining_elements));
+        }
+        return first + remaining_elements;
+    }
 
-        return dest_first;
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename T>
+    RandomAccessIterator remove_copy( ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first,
+        const T& value )
+    {
+        typedef typename std::iterator_traits<RandomAccessIterator>::value_type T;
+        return amp_stl_algorithms::copy_if(first, last, dest_first, [=](T& v) restrict(amp) { return (v != value); });
     }
 
-    // The "BinaryFunction" functor needs to be callable as "func(ConstRandomAccessIterator1::value_type, ConstRandomAccessIterator2::value_type)".
-    // The functor needs to be blittable and cannot contain any array, array_view, or textures.
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator remove_copy_if( ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first,
+        UnaryPredicate p )
+    {
+        typedef typename std::iterator_traits<RandomAccessIterator>::value_type T;
+        return amp_stl_algorithms::copy_if(first, last, dest_first, [=](T& v) restrict(amp) { return !p(v); });
+    }
 
-    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename BinaryFunction>
-    RandomAccessIterator transform( ConstRandomAccessIterator1 first1, 
-        ConstRandomAccessIterator1 last1,
-        ConstRandomAccessIterator2 first2, 
+    //----------------------------------------------------------------------------
+    // replace, replace_if, replace_copy, replace_copy_if
+    //----------------------------------------------------------------------------
+
+    template<typename RandomAccessIterator, typename T>
+    void replace( RandomAccessIterator first, 
+        RandomAccessIterator last,
+        const T& old_value, 
+        const T& new_value )
+    {
+        typedef std::iterator_traits<RandomAccessIterator>::value_type T;
+
+        amp_stl_algorithms::replace_if(first, last, [=](const T& v) restrict(amp) { return (v == old_value); }, new_value);
+    }
+
+    template<typename RandomAccessIterator, typename UnaryPredicate, typename T>
+    void replace_if( RandomAccessIterator first, 
+        RandomAccessIterator last,
+        UnaryPredicate p, 
+        const T& new_value )
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+        const int tile_size = 512;
+
+        difference_type element_count = std::distance(first, last);
+        if (element_count <= 0) 
+        {
+            return;
+        }
+        auto src_view = _details::create_section(first, element_count);
+
+        amp_algorithms::_details::parallel_for_each(_details::target_view(), concurrency::tiled_extent<tile_size>(src_view.extent).pad(), 
+            [element_count, new_value, src_view, p](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        {
+            int idx = tidx.global[0];
+            if ((idx < element_count) && p(src_view[idx]))
+            {
+                src_view[idx] = new_value;
+            }
+        });
+    }
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename T>
+    RandomAccessIterator replace_copy( ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last,
         RandomAccessIterator dest_first,
-        BinaryFunction func)
+        const T& old_value,
+        const T& new_value )
     {
-        typedef std::iterator_traits<ConstRandomAccessIterator1>::difference_type difference_type;
+        return amp_stl_algorithms::replace_copy_if(first, last, dest_first, [=](const T& v) restrict(amp) { return (v == old_value); }, new_value);
+    }
 
-        difference_type element_count = std::distance(first1, last1);
-        if (element_count <= 0)
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryPredicate, typename T>
+    RandomAccessIterator replace_copy_if( ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first,
+        UnaryPredicate p,
+        const T& new_value )
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+        const int tile_size = 512;
+
+        difference_type element_count = std::distance(first, last);
+        if (element_count <= 0) 
         {
             return dest_first;
         }
-        // TODO: input view should be const.
-        auto input1_view = _details::create_section(first1, element_count);
-        auto input2_view = _details::create_section(first2, element_count);
-        auto output_view = _details::create_section(dest_first, element_count);
-        output_view.discard_data();
+        auto src_view = _details::create_section(first, element_count);
+        auto dest_view = _details::create_section(dest_first, element_count);
 
-        concurrency::parallel_for_each(output_view.extent, [func,input1_view,input2_view,output_view] (concurrency::index<1> idx) restrict(amp) {
-            output_view[idx] = func(input1_view[idx], input2_view[idx]);
+        int last_changed_idx = 0;
+        concurrency::array_view<int> last_changed_idx_av(1, &last_changed_idx);
+
+        amp_algorithms::_details::parallel_for_each(_details::target_view(), concurrency::tiled_extent<tile_size>(src_view.extent).pad(), 
+            [element_count, new_value, src_view, dest_view, last_changed_idx_av, p](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        {
+            int idx = tidx.global[0];
+            if (idx < element_count)
+            {
+                if (p(src_view[idx]))
+                {
+                    dest_view[idx] = new_value;
+                    concurrency::atomic_fetch_max(&last_changed_idx_av(0), idx + 1);
+                }
+                else
+                {
+                    dest_view[idx] = src_view[idx];
+                }
+            }
         });
 
-        return dest_first;
+        return dest_first + last_changed_idx_av[0];
+    }
+
+    //----------------------------------------------------------------------------
+    // reverse, reverse_copy
+    //----------------------------------------------------------------------------
+
+    template<typename RandomAccessIterator>
+    void reverse( RandomAccessIterator first, RandomAccessIterator last )
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<RandomAccessIterator>::difference_type diff_type;
+        const int tile_size = 512;
+
+        const diff_type element_count = std::distance(first, last);
+        if (element_count <= 1) 
+        {
+            return;
+        }
+        auto src_view = _details::create_section(first, element_count);
+        const int last_element = element_count - 1;
+
+        concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(element_count >> 1);
+        amp_algorithms::_details::parallel_for_each(_details::target_view(), compute_domain.pad(), [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp) 
+        {
+            const int idx = tidx.global[0];
+            if (idx < element_count)
+            {
+                amp_stl_algorithms::swap(src_view[idx], src_view[last_element - idx]);
+            }
+        });
+    }
+
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator>
+    RandomAccessIterator reverse_copy( ConstRandomAccessIterator first, 
+        ConstRandomAccessIterator last, 
+        RandomAccessIterator dest_first)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<RandomAccessIterator>::difference_type diff_type;
+
+        const diff_type element_count = std::distance(first, last);
+        if (element_count <= 0) 
+        {
+            return dest_first;
+        }
+        auto src_view = _details::create_section(first, element_count);
+        auto dest_view = _details::create_section(dest_first, element_count);
+        const int last_element = element_count - 1;
+
+        amp_algorithms::_details::for_each_index(_details::target_view(), dest_view.extent, [=](concurrency::index<1> idx) restrict(amp) 
+        {
+            dest_view[idx] = src_view[last_element - idx[0]];
+        });
+
+        return dest_first + element_count;
+    }
+
+    //----------------------------------------------------------------------------
+    // rotate, rotate_copy
+    //----------------------------------------------------------------------------
+
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator>
+    RandomAccessIterator rotate_copy(ConstRandomAccessIterator first,
+        ConstRandomAccessIterator middle,
+        ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<RandomAccessIterator>::difference_type diff_type;
+        const diff_type element_count = std::distance(first, last);
+        const diff_type middle_offset = std::distance(first, middle);
+
+        auto src_view = _details::create_section(first, element_count);
+        auto dest_view = _details::create_section(dest_first, element_count);
+
+        amp_algorithms::_details::parallel_for_each(_details::target_view(), dest_view.extent, [=](concurrency::index<1> idx) restrict(amp)
+        {
+            dest_view[idx] = src_view[(idx + middle_offset) % element_count];
+        });
+        return dest_first + element_count;
     }
 
     //----------------------------------------------------------------------------
-    // unique, unique_copy
+    // search, search_n, binary_search
+    //----------------------------------------------------------------------------
+
+    //----------------------------------------------------------------------------
+    // set_difference, set_intersection, set_symetric_distance, set_union
     //----------------------------------------------------------------------------
 
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_difference( ConstRandomAccessIterator1 first1, 
+        ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, 
+        ConstRandomAccessIterator2 last2,
+        RandomAccessIterator d_first, 
+        Compare comp )
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        return _details::set_operation<_details::set_operation_type::set_difference>(first1, last1, first2, last2, d_first, comp);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator>
+    RandomAccessIterator set_difference( ConstRandomAccessIterator1 first1, 
+        ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, 
+        ConstRandomAccessIterator2 last2,
+        RandomAccessIterator d_first )
+    {
+        typedef typename std::iterator_traits<ConstRandomAccessIterator1>::value_type T;
+        return amp_stl_algorithms::set_difference(first1, last1, first2, last2, d_first, amp_algorithms::less<T>());
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_intersection( ConstRandomAccessIterator1 first1, 
+        ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, 
+        ConstRandomAccessIterator2 last2,
+        RandomAccessIterator d_first, 
+        Compare comp )
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        return _details::set_operation<_details::set_operation_type::set_intersection>(first1, last1, first2, last2, d_first, comp);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator>
+    RandomAccessIterator set_intersection( ConstRandomAccessIterator1 first1, 
+        ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, 
+        ConstRandomAccessIterator2 last2,
+        RandomAccessIterator d_first )
+    {
+        typedef typename std::iterator_traits<ConstRandomAccessIterator1>::value_type T;
+        return amp_stl_algorithms::set_intersection(first1, last1, first2, last2, d_first, amp_algorithms::less<T>());
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_symmetric_difference( ConstRandomAccessIterator1 first1, 
+        ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, 
+        ConstRandomAccessIterator2 last2,
+        RandomAccessIterator d_first, 
+        Compare comp )
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        return _details::set_operation<_details::set_operation_type::set_symmetric_difference>(first1, last1, first2, last2, d_first, comp);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator>
+    RandomAccessIterator set_symmetric_difference( ConstRandomAccessIterator1 first1, 
+        ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, 
+        ConstRandomAccessIterator2 last2,
+        RandomAccessIterator d_first )
+    {
+        typedef typename std::iterator_traits<ConstRandomAccessIterator1>::value_type T;
+        return amp_stl_algorithms::set_symmetric_difference(first1, last1, first2, last2, d_first, amp_algorithms::less<T>());
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_union( ConstRandomAccessIterator1 first1, 
+        ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, 
+        ConstRandomAccessIterator2 last2,
+        RandomAccessIterator d_first, 
+        Compare comp )
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        return _details::set_operation<_details::set_operation_type::set_union>(first1, last1, first2, last2, d_first, comp);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator>
+    RandomAccessIterator set_union( ConstRandomAccessIterator1 first1, 
+        ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, 
+        ConstRandomAccessIterator2 last2,
+        RandomAccessIterator d_first )
+    {
+        typedef typename std::iterator_traits<ConstRandomAccessIterator1>::value_type T;
+        return amp_stl_algorithms::set_union(first1, last1, first2, last2, d_first, amp_algorithms::less<T>());
+    }
+
+    //----------------------------------------------------------------------------
+    // shuffle, random_shuffle, 
+    //----------------------------------------------------------------------------
+
+    //----------------------------------------------------------------------------
+    // is_sorted, is_sorted_until, sort, partial_sort, partial_sort_copy, stable_sort
+    //----------------------------------------------------------------------------
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    ConstRandomAccessIterator is_sorted_until( ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp )
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
+        typedef typename std::iterator_traits<ConstRandomAccessIterator>::value_type T;
+
+        const diff_type element_count = std::distance(first, last);
+        if (element_count <= 1)
+        {
+            return last;
+        }
+        return _details::adjacent_find(first, element_count, 
+            [=](const T& a, const T& b) restrict(amp) { return !comp(a, b); }) + 1;
+    }
+
+    template<typename ConstRandomAccessIterator>
+    bool is_sorted( ConstRandomAccessIterator first, ConstRandomAccessIterator last )
+    {
+        typedef typename std::iterator_traits<ConstRandomAccessIterator>::value_type T;
+        return (amp_stl_algorithms::is_sorted_until(first, last, amp_algorithms::less_equal<T>()) == last);
+    }
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    bool is_sorted( ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp )
+    {
+        return (amp_stl_algorithms::is_sorted_until(first, last, comp) == last);
+    }
+
+    template<typename ConstRandomAccessIterator>
+    ConstRandomAccessIterator is_sorted_until( ConstRandomAccessIterator first, ConstRandomAccessIterator last )
+    {
+        typedef typename std::iterator_traits<ConstRandomAccessIterator>::value_type T;
+        return amp_stl_algorithms::is_sorted_until(first, last, amp_algorithms::less_equal<T>());
+    }
+
+    //----------------------------------------------------------------------------
+    // swap, swap<T, N>, swap_ranges, iter_swap
+    //----------------------------------------------------------------------------
+
+    template<typename T>
+    void swap( T& a, T& b ) restrict(cpu, amp)
+    {
+        T tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    template<typename T, int N>
+    void swap( T (&a)[N], T (&b)[N]) restrict(cpu, amp)
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            amp_stl_algorithms::swap(a[i], b[i]);
+        }
+    }
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+    RandomAccessIterator2 swap_ranges(RandomAccessIterator1 first1,
+        RandomAccessIterator1 last1, 
+        RandomAccessIterator2 first2)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef std::iterator_traits<RandomAccessIterator1>::difference_type difference_type;
+        typedef std::iterator_traits<RandomAccessIterator1>::value_type T;
+        const int tile_size = 512;
+
+        difference_type element_count = std::distance(first1, last1);
+        if (element_count <= 0)
+        {
+            return first2;
+        }
+        concurrency::array_view<T> first1_view = _details::create_section(first1, element_count);
+        concurrency::array_view<T> first2_view = _details::create_section(first2, element_count);
+
+        concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(element_count >> 1);
+        amp_algorithms::_details::parallel_for_each(_details::target_view(), compute_domain.pad(), [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp) 
+        {
+            const int idx = tidx.global[0];
+            if (idx < element_count)
+            {
+                amp_stl_algorithms::swap(first1_view[idx], first2_view[idx]);
+            }
+        });
+
+        return first2 + element_count;
+    }
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+    void iter_swap( RandomAccessIterator1 a, RandomAccessIterator2 b ) restrict(cpu, amp)
+    {
+        amp_stl_algorithms::swap(*a, *b);
+    }
+
+    //----------------------------------------------------------------------------
+    // transform (Unary)
+    //----------------------------------------------------------------------------
+
+    // The "UnaryFunction" functor needs to be callable as "func(ConstRandomAccessIterator::value_type)".
+    // The functor needs to be blittable and cannot contain any array, array_view, or textures.
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryFunction>
+    RandomAccessIterator transform( ConstRandomAccessIterator first, 
+        ConstRandomAccessIterator last, 
+        RandomAccessIterator dest_first,
+        UnaryFunction func)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef std::iterator_traits<ConstRandomAccessIterator>::difference_type difference_type;
+
+        difference_type element_count = std::distance(first, last);
+        if (element_count <= 0)
+        {
+            return dest_first;
+        }
+        // TODO: input view should be const.
+        auto input_view = _details::create_section(first, element_count);
+        auto output_view = _details::create_section(dest_first, element_count);
+        output_view.discard_data();
+
+        amp_algorithms::_details::for_each_index(_details::target_view(), output_view.extent, [func,input_view,output_view] (concurrency::index<1> idx) restrict(amp) {
+            output_view[idx] = func(input_view[idx]);
+        });
+
+        return dest_first;
+    }
+
+    // The "BinaryFunction" functor needs to be callable as "func(ConstRandomAccessIterator1::value_type, ConstRandomAccessIterator2::value_type)".
+    // The functor needs to be blittable and cannot contain any array, array_view, or textures.
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename BinaryFunction>
+    RandomAccessIterator transform( ConstRandomAccessIterator1 first1, 
+        ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, 
+        RandomAccessIterator dest_first,
+        BinaryFunction func)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef std::iterator_traits<ConstRandomAccessIterator1>::difference_type difference_type;
+
+        difference_type element_count = std::distance(first1, last1);
+        if (element_count <= 0)
+        {
+            return dest_first;
+        }
+        // TODO: input view should be const.
+        auto input1_view = _details::create_section(first1, element_count);
+        auto input2_view = _details::create_section(first2, element_count);
+        auto output_view = _details::create_section(dest_first, element_count);
+        output_view.discard_data();
+
+        amp_algorithms::_details::for_each_index(_details::target_view(), output_view.extent, [func,input1_view,input2_view,output_view] (concurrency::index<1> idx) restrict(amp) {
+            output_view[idx] = func(input1_view[idx], input2_view[idx]);
+        });
+
+        return dest_first;
+    }
+
+    //----------------------------------------------------------------------------
+    // unique, unique_copy, unique_by_key, unique_by_key_copy
+    //----------------------------------------------------------------------------
+    //
+    // Each element is flagged if it is the head of a group, i.e. it is the first element or is not equivalent 
+    // to the element before it. The flags are then used to compact the heads into the output.
+
+    namespace _details
+    {
+        template <int tile_size, typename InputIndexableView, typename BinaryPredicate>
+        void flag_group_heads(const InputIndexableView& src_view, concurrency::array_view<unsigned int>& map_vw, 
+            const int element_count, BinaryPredicate p)
+        {
+            typedef typename std::remove_const<typename InputIndexableView::value_type>::type T;
+
+            concurrency::tiled_extent<tile_size> compute_domain = concurrency::extent<1>(element_count).tile<tile_size>().pad();
+            amp_algorithms::_details::parallel_for_each(_details::target_view(), compute_domain, [=](concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                const int gidx = tidx.global[0];
+                const int i = tidx.local[0];
+                tile_static T local_buffer[tile_size + 1];
+
+                // local_buffer[i] holds the predecessor of element gidx.
+                local_buffer[i + 1] = padded_read(src_view, gidx);
+                if (i == 0)
+                {
+                    local_buffer[0] = padded_read(src_view, gidx - 1);
+                }
+
+                tidx.barrier.wait_with_tile_static_memory_fence();
+
+                map_vw[gidx] = ((gidx < element_count) && ((gidx == 0) || !p(local_buffer[i], local_buffer[i + 1]))) ? 1 : 0;
+            });
+        }
+
+        template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+            typename BinaryPredicate>
+        std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key_copy(ConstRandomAccessIterator1 keys_first,
+            const int element_count,
+            ConstRandomAccessIterator2 values_first,
+            RandomAccessIterator1 keys_dest_first,
+            RandomAccessIterator2 values_dest_first,
+            BinaryPredicate p)
+        {
+            static const int tile_size = 512;
+
+            auto keys_view = _details::create_section(keys_first, element_count);
+            auto values_view = _details::create_section(values_first, element_count);
+
+            const auto map = _details::create_flags_map<tile_size>(element_count);
+            concurrency::array_view<unsigned int> map_vw = map.view();
+            _details::flag_group_heads<tile_size>(keys_view, map_vw, element_count, p);
+
+            const int unique_count = _details::scan_flags(map_vw, element_count);
+            auto keys_dest_view = _details::create_section(keys_dest_first, unique_count);
+            auto values_dest_view = _details::create_section(values_dest_first, unique_count);
+            keys_dest_view.discard_data();
+            values_dest_view.discard_data();
+            _details::scatter_flagged<tile_size>(keys_view, keys_dest_view, map_vw, element_count);
+            _details::scatter_flagged<tile_size>(values_view, values_dest_view, map_vw, element_count);
+
+            return std::make_pair(keys_dest_first + unique_count, values_dest_first + unique_count);
+        }
+    } // namespace _details
+
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator, typename BinaryPredicate>
+    RandomAccessIterator unique_copy( ConstRandomAccessIterator first, 
+        ConstRandomAccessIterator last, 
+        RandomAccessIterator dest_first, 
+        BinaryPredicate p)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<ConstRandomAccessIterator>::difference_type diff_type;
+        static const int tile_size = 512;
+
+        const diff_type element_count = std::distance(first, last);
+        if (element_count <= 0)
+        {
+            return dest_first;
+        }
+        auto src_view = _details::create_section(first, element_count);
+
+        const auto map = _details::create_flags_map<tile_size>(element_count);
+        concurrency::array_view<unsigned int> map_vw = map.view();
+        _details::flag_group_heads<tile_size>(src_view, map_vw, element_count, p);
+
+        const int unique_count = _details::scan_flags(map_vw, element_count);
+        auto dest_view = _details::create_section(dest_first, unique_count);
+        dest_view.discard_data();
+        _details::scatter_flagged<tile_size>(src_view, dest_view, map_vw, element_count);
+
+        return dest_first + unique_count;
+    }
+
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator>
+    RandomAccessIterator unique_copy( ConstRandomAccessIterator first, ConstRandomAccessIterator last, RandomAccessIterator dest_first )
+    {
+        typedef typename std::iterator_traits<ConstRandomAccessIterator>::value_type T;
+        return amp_stl_algorithms::unique_copy(first, last, dest_first, amp_algorithms::equal_to<T>());
+    }
+
+    // Compacting in place would overwrite elements before other threads had read them, so the unique 
+    // elements are written to a temporary that is then copied back.
+
+    template<typename RandomAccessIterator, typename BinaryPredicate>
+    RandomAccessIterator unique( RandomAccessIterator first, RandomAccessIterator last, BinaryPredicate p)
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<RandomAccessIterator>::difference_type diff_type;
+        typedef typename std::iterator_traits<RandomAccessIterator>::value_type T;
+
+        const diff_type element_count = std::distance(first, last);
+        if (element_count <= 1)
+        {
+            return last;
+        }
+        auto src_view = _details::create_section(first, element_count);
+
+        const amp_algorithms::_details::scratch_array<T> tmp(element_count, _details::scratch_view());
+        concurrency::array_view<T> tmp_view = tmp.view();
+        const int unique_count = static_cast<int>(std::distance(begin(tmp_view), amp_stl_algorithms::unique_copy(first, last, begin(tmp_view), p)));
+        amp_algorithms::_details::traced_copy(tmp_view.section(0, unique_count), src_view.section(0, unique_count));
+        return first + unique_count;
+    }
+
+    template<typename RandomAccessIterator>
+    RandomAccessIterator unique( RandomAccessIterator first, RandomAccessIterator last)
+    {
+        typedef typename std::iterator_traits<RandomAccessIterator>::value_type T;
+        return amp_stl_algorithms::unique(first, last, amp_algorithms::equal_to<T>());
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryPredicate>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key_copy( ConstRandomAccessIterator1 keys_first,
+        ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first,
+        RandomAccessIterator1 keys_dest_first,
+        RandomAccessIterator2 values_dest_first,
+        BinaryPredicate p )
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<ConstRandomAccessIterator1>::difference_type diff_type;
+
+        const diff_type element_count = std::distance(keys_first, keys_last);
+        if (element_count <= 0)
+        {
+            return std::make_pair(keys_dest_first, values_dest_first);
+        }
+        return _details::unique_by_key_copy(keys_first, element_count, values_first, keys_dest_first, values_dest_first, p);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key_copy( ConstRandomAccessIterator1 keys_first,
+        ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first,
+        RandomAccessIterator1 keys_dest_first,
+        RandomAccessIterator2 values_dest_first )
+    {
+        typedef typename std::iterator_traits<ConstRandomAccessIterator1>::value_type T;
+        return amp_stl_algorithms::unique_by_key_copy(keys_first, keys_last, values_first, keys_dest_first, values_dest_first, amp_algorithms::equal_to<T>());
+    }
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryPredicate>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key( RandomAccessIterator1 keys_first,
+        RandomAccessIterator1 keys_last,
+        RandomAccessIterator2 values_first,
+        BinaryPredicate p )
+    {
+        AMP_ALGORITHMS_TRACE_ALGORITHM();
+        typedef typename std::iterator_traits<RandomAccessIterator1>::difference_type diff_type;
+        typedef typename std::iterator_traits<RandomAccessIterator1>::value_type Key;
+        typedef typename std::iterator_traits<RandomAccessIterator2>::value_type Value;
+
+        const diff_type element_count = std::distance(keys_first, keys_last);
+        if (element_count <= 1)
+        {
+            return std::make_pair(keys_last, values_first + element_count);
+        }
+        auto keys_view = _details::create_section(keys_first, element_count);
+        auto values_view = _details::create_section(values_first, element_count);
+
+        const amp_algorithms::_details::scratch_array<Key> keys_tmp(element_count, _details::scratch_view());
+        concurrency::array_view<Key> keys_tmp_view = keys_tmp.view();
+        const amp_algorithms::_details::scratch_array<Value> values_tmp(element_count, _details::scratch_view());
+        concurrency::array_view<Value> values_tmp_view = values_tmp.view();
+
+        auto r = _details::unique_by_key_copy(keys_first, element_count, values_first, begin(keys_tmp_view), begin(values_tmp_view), p);
+        const int unique_count = static_cast<int>(std::distance(begin(keys_tmp_view), r.first));
+        amp_algorithms::_details::traced_copy(keys_tmp_view.section(0, unique_count), keys_view.section(0, unique_count));
+        amp_algorithms::_details::traced_copy(values_tmp_view.section(0, unique_count), values_view.section(0, unique_count));
+        return std::make_pair(keys_first + unique_count, values_first + unique_count);
+    }
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key( RandomAccessIterator1 keys_first,
+        RandomAccessIterator1 keys_last,
+        RandomAccessIterator2 values_first )
+    {
+        typedef typename std::iterator_traits<RandomAccessIterator1>::value_type T;
+        return amp_stl_algorithms::unique_by_key(keys_first, keys_last, values_first, amp_algorithms::equal_to<T>());
+    }
+
+    //----------------------------------------------------------------------------
+    // execution policy overloads
+    //----------------------------------------------------------------------------
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator>
+    RandomAccessIterator adjacent_difference(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, RandomAccessIterator dest_first)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::adjacent_difference(first, last, dest_first);
+    }
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename BinaryOperation>
+    RandomAccessIterator adjacent_difference(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first, BinaryOperation op)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::adjacent_difference(first, last, dest_first, op);
+    }
+
+    template<typename ConstRandomAccessIterator,  typename UnaryPredicate>
+    bool all_of(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::all_of(first, last, p);
+    }
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    bool any_of(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::any_of(first, last, p);
+    }
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    bool none_of(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::none_of(first, last, p);
+    }
+
+    template<typename ConstRandomAccessIterator,  typename UnaryPredicate, typename OutputIterator>
+    void any_of(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        UnaryPredicate p, OutputIterator dest)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::any_of(first, last, p, dest);
+    }
+
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator>
+    RandomAccessIterator copy(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, RandomAccessIterator dest_beg)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::copy(first, last, dest_beg);
+    }
+
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator copy_if(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::copy_if(first, last, dest, p);
+    }
+
+    template<typename ConstRandomAccessIterator, typename Size, typename RandomAccessIterator>
+    RandomAccessIterator copy_n(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        Size count, RandomAccessIterator result)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::copy_n(first, count, result);
+    }
+
+    template<typename ConstRandomAccessIterator, typename T>
+    typename std::iterator_traits<ConstRandomAccessIterator>::difference_type count(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, const T &value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::count(first, last, value);
+    }
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    typename std::iterator_traits<ConstRandomAccessIterator>::difference_type count_if(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::count_if(first, last, p);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2>
+    bool equal(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1,
+        ConstRandomAccessIterator1 last1, ConstRandomAccessIterator2 first2)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::equal(first1, last1, first2);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename BinaryPredicate>
+    bool equal(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, BinaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::equal(first1, last1, first2, p);
+    }
+
+    template<typename RandomAccessIterator, typename T>
+    void fill(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last, const T& value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::fill(first, last, value);
+    }
+
+    template<typename RandomAccessIterator, typename Size, typename T>
+    RandomAccessIterator fill_n(const execution::execution_policy& policy, RandomAccessIterator first, Size count, const T& value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::fill_n(first, count, value);
+    }
+
+    template<typename ConstRandomAccessIterator, typename T>
+    ConstRandomAccessIterator find(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, const T& value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::find(first, last, value);
+    }
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    ConstRandomAccessIterator find_if(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::find_if(first, last, p);
+    }
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    ConstRandomAccessIterator find_if_not(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::find_if_not(first, last, p);
+    }
+
+    template<typename ConstRandomAccessIterator>
+    ConstRandomAccessIterator adjacent_find(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::adjacent_find(first, last);
+    }
+
+    template<typename ConstRandomAccessIterator, typename Predicate>
+    ConstRandomAccessIterator adjacent_find(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, Predicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::adjacent_find(first, last, p);
+    }
+
+    template<typename ConstRandomAccessIterator, typename UnaryFunction>
+    UnaryFunction for_each(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryFunction f)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::for_each(first, last, f);
+    }
+
+    template<typename ConstRandomAccessIterator, typename UnaryFunction>
+    void for_each_no_return(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryFunction f)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::for_each_no_return(first, last, f);
+    }
+
+    template<typename RandomAccessIterator, typename Generator>
+    void generate(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last, Generator g)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::generate(first, last, g);
+    }
+
+    template<typename RandomAccessIterator, typename Size, typename Generator>
+    RandomAccessIterator generate_n(const execution::execution_policy& policy, RandomAccessIterator first, Size count, Generator g)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::generate_n(first, count, g);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2>
+    bool includes(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::includes(first1, last1, first2, last2);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename Compare>
+    bool includes(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, Compare comp)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::includes(first1, last1, first2, last2, comp);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename T>
+    T inner_product(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, const T value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::inner_product(first1, last1, first2, value);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename T,
+        typename BinaryOperation1, typename BinaryOperation2>
+    T inner_product(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, const T value, const BinaryOperation1& binary_op1, const BinaryOperation2& binary_op2)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::inner_product(first1, last1, first2, value, binary_op1, binary_op2);
+    }
+
+    template<typename RandomAccessIterator, typename T>
+    void iota(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last, T value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::iota(first, last, value);
+    }
+
+    template<typename ConstRandomAccessIterator>
+    ConstRandomAccessIterator min_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::min_element(first, last);
+    }
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    ConstRandomAccessIterator min_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, Compare comp)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::min_element(first, last, comp);
+    }
+
+    template<typename ConstRandomAccessIterator>
+    ConstRandomAccessIterator max_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::max_element(first, last);
+    }
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    ConstRandomAccessIterator max_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, Compare comp)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::max_element(first, last, comp);
+    }
+
+    template<typename ConstRandomAccessIterator>
+    std::pair<ConstRandomAccessIterator,ConstRandomAccessIterator> minmax_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::minmax_element(first, last);
+    }
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    std::pair<ConstRandomAccessIterator,ConstRandomAccessIterator> minmax_element(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, Compare comp)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::minmax_element(first, last, comp);
+    }
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    bool is_partitioned(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::is_partitioned(first, last, p);
+    }
+
+    template<typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator partition(const execution::execution_policy& policy, RandomAccessIterator first,
+        RandomAccessIterator last, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::partition(first, last, p);
+    }
+
+    template<typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator stable_partition(const execution::execution_policy& policy, RandomAccessIterator first,
+        RandomAccessIterator last, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::stable_partition(first, last, p);
+    }
+
+    template<typename ConstRandomAccessIterator, typename UnaryPredicate>
+    ConstRandomAccessIterator partition_point(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::partition_point(first, last, p);
+    }
+
+    template<typename ConstRandomAccessIterator, typename T>
+    T reduce(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last, T init)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::reduce(first, last, init);
+    }
+
+    template<typename ConstRandomAccessIterator, typename T, typename BinaryOperation>
+    T reduce(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        T init, BinaryOperation op)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::reduce(first, last, init, op);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2>
+    int reduce_by_key(const execution::execution_policy& policy, ConstRandomAccessIterator1 keys_first, ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first, RandomAccessIterator1 keys_dest_first, RandomAccessIterator2 values_dest_first)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::reduce_by_key(keys_first, keys_last, values_first, keys_dest_first, values_dest_first);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryOperation>
+    int reduce_by_key(const execution::execution_policy& policy, ConstRandomAccessIterator1 keys_first, ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first, RandomAccessIterator1 keys_dest_first, RandomAccessIterator2 values_dest_first, BinaryOperation op)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::reduce_by_key(keys_first, keys_last, values_first, keys_dest_first, values_dest_first, op);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryPredicate, typename BinaryOperation>
+    int reduce_by_key(const execution::execution_policy& policy, ConstRandomAccessIterator1 keys_first, ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first, RandomAccessIterator1 keys_dest_first, RandomAccessIterator2 values_dest_first, BinaryPredicate p, BinaryOperation op)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::reduce_by_key(keys_first, keys_last, values_first, keys_dest_first, values_dest_first, p, op);
+    }
+
+    template<typename RandomAccessIterator, typename T>
+    RandomAccessIterator remove(const execution::execution_policy& policy, RandomAccessIterator first,
+        RandomAccessIterator last, const T& value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::remove(first, last, value);
+    }
+
+    template<typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator remove_if(const execution::execution_policy& policy, RandomAccessIterator first,
+        RandomAccessIterator last, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::remove_if(first, last, p);
+    }
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename T>
+    RandomAccessIterator remove_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first, const T& value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::remove_copy(first, last, dest_first, value);
+    }
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryPredicate>
+    RandomAccessIterator remove_copy_if(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first, UnaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::remove_copy_if(first, last, dest_first, p);
+    }
+
+    template<typename RandomAccessIterator, typename T>
+    void replace(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last,
+        const T& old_value, const T& new_value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::replace(first, last, old_value, new_value);
+    }
+
+    template<typename RandomAccessIterator, typename UnaryPredicate, typename T>
+    void replace_if(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last,
+        UnaryPredicate p, const T& new_value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::replace_if(first, last, p, new_value);
+    }
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename T>
+    RandomAccessIterator replace_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first, const T& old_value, const T& new_value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::replace_copy(first, last, dest_first, old_value, new_value);
+    }
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryPredicate, typename T>
+    RandomAccessIterator replace_copy_if(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator dest_first, UnaryPredicate p, const T& new_value)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::replace_copy_if(first, last, dest_first, p, new_value);
+    }
+
+    template<typename RandomAccessIterator>
+    void reverse(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::reverse(first, last);
+    }
+
+    template<typename ConstRandomAccessIterator, typename RandomAccessIterator>
+    RandomAccessIterator reverse_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, RandomAccessIterator dest_first)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::reverse_copy(first, last, dest_first);
+    }
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator>
+    RandomAccessIterator rotate_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator middle,
+        ConstRandomAccessIterator last, RandomAccessIterator dest_first)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::rotate_copy(first, middle, last, dest_first);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
+    RandomAccessIterator set_difference(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::set_difference(first1, last1, first2, last2, d_first);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_difference(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first, Compare comp)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::set_difference(first1, last1, first2, last2, d_first, comp);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
+    RandomAccessIterator set_intersection(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::set_intersection(first1, last1, first2, last2, d_first);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_intersection(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first, Compare comp)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::set_intersection(first1, last1, first2, last2, d_first, comp);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
+    RandomAccessIterator set_symmetric_difference(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::set_symmetric_difference(first1, last1, first2, last2, d_first);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_symmetric_difference(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first, Compare comp)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::set_symmetric_difference(first1, last1, first2, last2, d_first, comp);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator>
+    RandomAccessIterator set_union(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::set_union(first1, last1, first2, last2, d_first);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator set_union(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, ConstRandomAccessIterator2 last2, RandomAccessIterator d_first, Compare comp)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::set_union(first1, last1, first2, last2, d_first, comp);
+    }
+
+    template<typename ConstRandomAccessIterator>
+    bool is_sorted(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::is_sorted(first, last);
+    }
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    bool is_sorted(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last, Compare comp)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::is_sorted(first, last, comp);
+    }
+
+    template<typename ConstRandomAccessIterator>
+    ConstRandomAccessIterator is_sorted_until(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::is_sorted_until(first, last);
+    }
+
+    template<typename ConstRandomAccessIterator, typename Compare>
+    ConstRandomAccessIterator is_sorted_until(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, Compare comp)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::is_sorted_until(first, last, comp);
+    }
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+    RandomAccessIterator2 swap_ranges(const execution::execution_policy& policy, RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+        RandomAccessIterator2 first2)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::swap_ranges(first1, last1, first2);
+    }
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename UnaryFunction>
+    RandomAccessIterator transform(const execution::execution_policy& policy, ConstRandomAccessIterator first1, ConstRandomAccessIterator last1,
+        RandomAccessIterator result, UnaryFunction func)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::transform(first1, last1, result, func);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2,typename RandomAccessIterator, typename BinaryFunction>
+    RandomAccessIterator transform(const execution::execution_policy& policy, ConstRandomAccessIterator1 first1, ConstRandomAccessIterator1 last1,
+        ConstRandomAccessIterator2 first2, RandomAccessIterator dest_first, BinaryFunction func)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::transform(first1, last1, first2, dest_first, func);
+    }
+
+    template<typename RandomAccessIterator>
+    RandomAccessIterator unique(const execution::execution_policy& policy, RandomAccessIterator first, RandomAccessIterator last)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::unique(first, last);
+    }
+
+    template<typename RandomAccessIterator, typename BinaryPredicate>
+    RandomAccessIterator unique(const execution::execution_policy& policy, RandomAccessIterator first,
+        RandomAccessIterator last, BinaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::unique(first, last, p);
+    }
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator>
+    RandomAccessIterator unique_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first,
+        ConstRandomAccessIterator last, RandomAccessIterator d_first)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::unique_copy(first, last, d_first);
+    }
+
+    template<typename ConstRandomAccessIterator,typename RandomAccessIterator, typename BinaryPredicate>
+    RandomAccessIterator unique_copy(const execution::execution_policy& policy, ConstRandomAccessIterator first, ConstRandomAccessIterator last,
+        RandomAccessIterator d_first, BinaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::unique_copy(first, last, d_first, p);
+    }
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key(const execution::execution_policy& policy, RandomAccessIterator1 keys_first,
+        RandomAccessIterator1 keys_last, RandomAccessIterator2 values_first)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::unique_by_key(keys_first, keys_last, values_first);
+    }
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryPredicate>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key(const execution::execution_policy& policy, RandomAccessIterator1 keys_first, RandomAccessIterator1 keys_last,
+        RandomAccessIterator2 values_first, BinaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::unique_by_key(keys_first, keys_last, values_first, p);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key_copy(const execution::execution_policy& policy, ConstRandomAccessIterator1 keys_first, ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first, RandomAccessIterator1 keys_dest_first, RandomAccessIterator2 values_dest_first)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::unique_by_key_copy(keys_first, keys_last, values_first, keys_dest_first, values_dest_first);
+    }
+
+    template<typename ConstRandomAccessIterator1, typename ConstRandomAccessIterator2, typename RandomAccessIterator1, typename RandomAccessIterator2, 
+        typename BinaryPredicate>
+    std::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key_copy(const execution::execution_policy& policy, ConstRandomAccessIterator1 keys_first, ConstRandomAccessIterator1 keys_last,
+        ConstRandomAccessIterator2 values_first, RandomAccessIterator1 keys_dest_first, RandomAccessIterator2 values_dest_first, BinaryPredicate p)
+    {
+        const _details::target_view_scope scope(policy);
+        return amp_stl_algorithms::unique_by_key_copy(keys_first, keys_last, values_first, keys_dest_first, values_dest_first, p);
+    }
+
 }// namespace amp_stl_algorithms
@@ -28,7 +28,6 @@ using namespace concurrency;
 using namespace amp_algorithms;
 using namespace testtools;
 
-// TODO: Add tests for indexable_view_traits
 class amp_algorithms_tests : public stl_algorithms_testbase<13>, public ::testing::Test {};
 
 TEST_F(amp_algorithms_tests, padded_read)
@@ -134,3 +133,209 @@ TEST_F(amp_algorithms_tests, fill_int)
         EXPECT_EQ(7, e);
     }
 }
+
+TEST_F(amp_algorithms_tests, for_each_index_visits_every_element_once)
+{
+    // A grid of at most 4 tiles of 32 threads with 2 items each covers 256 elements per pass.
+    const int sizes[] = { 1, 63, 64, 65, 255, 256, 257, 1000, 4096 };
+    for (auto size : sizes)
+    {
+        std::vector<int> vec(size, 0);
+        array_view<int> av(size, vec);
+
+        _details::for_each_index<32, 2, 4>(accelerator().default_view, size, [=](const int idx) restrict(amp)
+        {
+            concurrency::atomic_fetch_inc(&av[idx]);
+        });
+        av.synchronize();
+
+        ASSERT_TRUE(std::all_of(cbegin(vec), cend(vec), [](int e) { return e == 1; })) << "size " << size;
+    }
+}
+
+TEST_F(amp_algorithms_tests, fill_rank_2_multiple_passes)
+{
+    // Larger than one pass of the default element-wise grid.
+    const int height = 1031;
+    const int width = 2053;
+    std::vector<int> vec(height * width, 0);
+    array_view<int, 2> av(height, width, vec);
+    av.discard_data();
+
+    amp_algorithms::fill(av, 7);
+    av.synchronize();
+
+    ASSERT_TRUE(std::all_of(cbegin(vec), cend(vec), [](int e) { return e == 7; }));
+}
+
+TEST_F(amp_algorithms_tests, scratch_pool_reuses_released_buffers)
+{
+    // A new view has a pool of its own, so other tests do not affect the cached byte counts.
+    const accelerator_view view = accelerator().create_view();
+    {
+        const _details::scratch_array<int> a(1000, view);
+        ASSERT_EQ(0u, get_scratch_cached_bytes(view));
+    }
+    ASSERT_EQ(1024u * sizeof(int), get_scratch_cached_bytes(view));
+
+    {
+        // Same size class, served from the cache.
+        const _details::scratch_array<float> b(900, view);
+        ASSERT_EQ(0u, get_scratch_cached_bytes(view));
+
+        std::vector<float> expected(900, 3.0f);
+        auto b_view = b.view();
+        amp_algorithms::fill(view, b_view, 3.0f);
+        ASSERT_TRUE(are_equal(expected, b_view));
+    }
+    ASSERT_EQ(1024u * sizeof(int), get_scratch_cached_bytes(view));
+
+    trim_scratch(view);
+    ASSERT_EQ(0u, get_scratch_cached_bytes(view));
+    release_scratch(view);
+}
+
+TEST_F(amp_algorithms_tests, scratch_pool_high_water_mark)
+{
+    const accelerator_view view = accelerator().create_view();
+    set_scratch_high_water_mark(view, 1024 * sizeof(int));
+    {
+        const _details::scratch_array<int> a(1024, view);
+        const _details::scratch_array<int> b(1024, view);
+    }
+    ASSERT_EQ(1024u * sizeof(int), get_scratch_cached_bytes(view));
+
+    set_scratch_high_water_mark(view, 0);
+    ASSERT_EQ(0u, get_scratch_cached_bytes(view));
+    ASSERT_EQ(0u, get_scratch_high_water_mark(view));
+    release_scratch(view);
+}
+
+TEST_F(amp_algorithms_tests, scratch_pool_release)
+{
+    const accelerator_view view = accelerator().create_view();
+    set_scratch_high_water_mark(view, 1024 * sizeof(int));
+    {
+        const _details::scratch_array<int> a(1024, view);
+        release_scratch(view);
+    }
+
+    // The released pool took its buffer and settings with it; the next use starts a new one.
+    ASSERT_EQ(0u, get_scratch_cached_bytes(view));
+    ASSERT_EQ(64u * 1024 * 1024, get_scratch_high_water_mark(view));
+    release_scratch(view);
+}
+
+TEST_F(amp_algorithms_tests, scratch_pool_does_not_cache_large_requests)
+{
+    const accelerator_view view = accelerator().create_view();
+    {
+        // Just over the largest bucket, allocated exactly rather than rounded up to 2^25 words.
+        const _details::scratch_array<int> a((1 << 24) + 1, view);
+    }
+    ASSERT_EQ(0u, get_scratch_cached_bytes(view));
+    release_scratch(view);
+}
+
+TEST_F(amp_algorithms_tests, scratch_pool_caches_readback_buffers)
+{
+    const accelerator_view view = accelerator().create_view();
+    std::vector<int> vec(1024, 1);
+    array_view<const int> av(1024, vec);
+    // A lambda is never dispatched to the host, so the reduction always reads back through a staging buffer.
+    const auto add = [](int a, int b) restrict(amp) { return a + b; };
+
+    ASSERT_EQ(1024, amp_algorithms::reduce(view, av, add));
+    const size_t cached = get_scratch_cached_bytes(view);
+    ASSERT_LT(0u, cached);
+
+    // The second call reuses the staging buffer returned by the first.
+    ASSERT_EQ(1024, amp_algorithms::reduce(view, av, add));
+    ASSERT_EQ(cached, get_scratch_cached_bytes(view));
+    release_scratch(view);
+}
+
+TEST_F(amp_algorithms_tests, fill_and_transform_async)
+{
+    std::vector<int> vec_in(1024);
+    array_view<int> av_in(1024, vec_in);
+    std::vector<int> vec_out(1024);
+    array_view<int> av_out(1024, vec_out);
+    av_in.discard_data();
+    av_out.discard_data();
+
+    auto filled = amp_algorithms::fill_async(av_in, 7);
+    auto transformed = amp_algorithms::transform_async(av_in, av_out, [] (int x) restrict(amp) { return 2 * x; });
+    filled.wait();
+    transformed.wait();
+    av_out.synchronize_async().wait();
+
+    for (auto e : vec_out) 
+    {
+        EXPECT_EQ(2 * 7, e);
+    }
+}
+
+TEST_F(amp_algorithms_tests, indexable_view_traits_contiguity)
+{
+    typedef array_view<const int, 2> matrix_type;
+
+    ASSERT_TRUE(indexable_view_traits<matrix_type>::is_contiguous);
+    ASSERT_EQ(1, indexable_view_traits<matrix_type>::contiguous_dimension);
+    ASSERT_FALSE(indexable_view_traits<transposed_view<matrix_type>>::is_contiguous);
+    ASSERT_EQ(0, indexable_view_traits<transposed_view<matrix_type>>::contiguous_dimension);
+    ASSERT_TRUE((indexable_view_traits<reshape_view<matrix_type, 1>>::is_contiguous));
+    ASSERT_FALSE((indexable_view_traits<reshape_view<transposed_view<matrix_type>, 1>>::is_contiguous));
+    ASSERT_FALSE(indexable_view_traits<reversed_view<array_view<int>>>::is_contiguous);
+    ASSERT_FALSE(indexable_view_traits<strided_view<array_view<int>>>::is_contiguous);
+    ASSERT_TRUE(indexable_view_traits<reversed_view<array_view<int>>>::is_writable);
+}
+
+TEST_F(amp_algorithms_tests, transform_reversed_and_strided_views)
+{
+    auto reversed_output = make_reversed_view(output_av);
+
+    amp_algorithms::transform(input_av, reversed_output, [](int x) restrict(amp) { return 2 * x; });
+    output_av.synchronize();
+
+    for (int i = 0; i < size; ++i)
+    {
+        ASSERT_EQ(2 * input[size - 1 - i], output[i]);
+    }
+
+    const auto every_third = make_strided_view(input_av, 3);
+    int expected_sum = 0;
+    for (int i = 0; i < size; i += 3)
+    {
+        expected_sum += input[i];
+    }
+    ASSERT_EQ((size + 2) / 3, every_third.extent[0]);
+    ASSERT_EQ(expected_sum, amp_algorithms::reduce(every_third, amp_algorithms::plus<int>()));
+}
+
+TEST_F(amp_algorithms_tests, transposed_and_reshaped_views)
+{
+    const int rows = 3;
+    const int cols = 5;
+    std::vector<int> vec_in(rows * cols);
+    std::iota(begin(vec_in), end(vec_in), 0);
+    array_view<const int, 2> av_in(rows, cols, vec_in);
+    std::vector<int> vec_out(rows * cols, -1);
+    array_view<int, 2> av_out(cols, rows, vec_out);
+
+    amp_algorithms::transform(make_transposed_view(av_in), av_out, [](int x) restrict(amp) { return x; });
+    av_out.synchronize();
+
+    for (int r = 0; r < rows; ++r)
+    {
+        for (int c = 0; c < cols; ++c)
+        {
+            ASSERT_EQ(vec_in[r * cols + c], vec_out[c * rows + r]);
+        }
+    }
+
+    const auto flat = make_reshape_view(av_in, concurrency::extent<1>(rows * cols));
+    ASSERT_EQ(7, flat[concurrency::index<1>(7)]);
+    ASSERT_EQ(std::accumulate(cbegin(vec_in), cend(vec_in), 0), amp_algorithms::reduce(flat, amp_algorithms::plus<int>()));
+    ASSERT_THROW(make_reshape_view(av_in, concurrency::extent<1>(rows * cols - 1)), runtime_exception);
+}
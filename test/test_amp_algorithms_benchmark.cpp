@@ -0,0 +1,182 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* C++ AMP standard algorithm library.
+*
+* This file contains unit tests for the benchmark harness.
+*---------------------------------------------------------------------------*/
+
+#include "stdafx.h"
+#include "../benchmark/benchmark.h"
+
+#include "testtools.h"
+
+using namespace concurrency;
+using namespace amp_benchmark;
+using namespace testtools;
+
+class amp_benchmark_tests : public testbase, public ::testing::Test {};
+
+TEST_F(amp_benchmark_tests, median_and_percentile)
+{
+    const double samples[] = { 5.0, 1.0, 4.0, 2.0, 3.0 };
+    const std::vector<double> odd(std::begin(samples), std::end(samples));
+    const std::vector<double> even(std::begin(samples), std::end(samples) - 1);
+
+    ASSERT_DOUBLE_EQ(3.0, median(odd));
+    ASSERT_DOUBLE_EQ(3.0, median(even));
+    ASSERT_DOUBLE_EQ(5.0, percentile(odd, 95.0));
+    ASSERT_DOUBLE_EQ(1.0, percentile(odd, 0.0));
+    ASSERT_DOUBLE_EQ(3.0, percentile(odd, 50.0));
+    ASSERT_DOUBLE_EQ(0.0, median(std::vector<double>()));
+}
+
+TEST_F(amp_benchmark_tests, summarize_reports_throughput_from_median)
+{
+    benchmark_case bench;
+    bench.name = "scan_exclusive";
+    bench.type = "int";
+    bench.bytes_per_element = 8;
+    std::vector<double> samples(3);
+    samples[0] = 4.0;
+    samples[1] = 2.0;
+    samples[2] = 8.0;
+
+    const benchmark_result result = summarize(bench, 1000000, samples);
+
+    ASSERT_EQ(3, result.repetitions);
+    ASSERT_DOUBLE_EQ(4.0, result.median_ms);
+    ASSERT_DOUBLE_EQ(8.0, result.p95_ms);
+    ASSERT_DOUBLE_EQ(2.0, result.min_ms);
+    ASSERT_DOUBLE_EQ(2.5e8, result.elements_per_second);
+    ASSERT_DOUBLE_EQ(2.0, result.gb_per_second);
+}
+
+TEST_F(amp_benchmark_tests, time_runs_warms_up_then_samples)
+{
+    benchmark_config config;
+    config.warmup_runs = 2;
+    config.repetitions = 5;
+    config.min_sample_ms = 0.0;
+    int calls = 0;
+
+    const std::vector<double> samples = time_runs(accelerator().default_view, config, [&]() { ++calls; });
+
+    ASSERT_EQ(5, samples.size());
+    ASSERT_EQ(7, calls);
+}
+
+TEST_F(amp_benchmark_tests, size_range_covers_both_ends)
+{
+    const std::vector<int> sizes = size_range(10, 28, 2);
+
+    ASSERT_EQ(10, sizes.size());
+    ASSERT_EQ(1024, sizes.front());
+    ASSERT_EQ(256 * 1024 * 1024, sizes.back());
+}
+
+TEST_F(amp_benchmark_tests, write_csv_and_json)
+{
+    benchmark_result result = { "reduce", "float", 1024, 10, 0.5, 0.75, 0.25, 2.048e6, 8.192e-3 };
+    std::ostringstream csv;
+    std::ostringstream json;
+
+    write_csv(csv, std::vector<benchmark_result>(1, result));
+    write_json(json, std::vector<benchmark_result>(1, result));
+
+    ASSERT_EQ(0, csv.str().find("name,type,size,repetitions,median_ms,p95_ms,min_ms,elements_per_second,gb_per_second\nreduce,float,1024,10,"));
+    ASSERT_NE(std::string::npos, json.str().find("{\"name\":\"reduce\",\"type\":\"float\",\"size\":1024,\"repetitions\":10,\"median_ms\":5.000000e-01,"));
+}
+
+TEST_F(amp_benchmark_tests, read_json_reads_write_json_output)
+{
+    std::vector<benchmark_result> results;
+    benchmark_result r1 = { "radix_sort", "unsigned", 65536, 10, 1.5, 1.75, 1.25, 4.4e7, 0.35 };
+    benchmark_result r2 = { "find", "int", 1024, 5, 0.125, 0.25, 0.0625, 8.2e6, 0.033 };
+    results.push_back(r1);
+    results.push_back(r2);
+    std::stringstream stream;
+    write_json(stream, results);
+
+    const std::vector<benchmark_result> read = read_json(stream);
+
+    ASSERT_EQ(2, read.size());
+    ASSERT_EQ("radix_sort", read[0].name);
+    ASSERT_EQ("unsigned", read[0].type);
+    ASSERT_EQ(65536, read[0].size);
+    ASSERT_DOUBLE_EQ(1.75, read[0].p95_ms);
+    ASSERT_EQ("find", read[1].name);
+    ASSERT_DOUBLE_EQ(0.125, read[1].median_ms);
+}
+
+TEST_F(amp_benchmark_tests, read_json_rejects_other_input)
+{
+    std::istringstream stream("name,type\nreduce,int\n");
+
+    ASSERT_THROW(read_json(stream), std::runtime_error);
+}
+
+TEST_F(amp_benchmark_tests, compare_to_baseline_allows_for_noise)
+{
+    std::vector<benchmark_result> baseline;
+    benchmark_result quiet = { "scan_exclusive", "int", 4096, 10, 1.0, 1.0, 1.0, 0.0, 0.0 };
+    benchmark_result noisy = { "reduce", "int", 4096, 10, 1.0, 1.5, 0.9, 0.0, 0.0 };
+    baseline.push_back(quiet);
+    baseline.push_back(noisy);
+    std::vector<benchmark_result> current = baseline;
+    current[0].median_ms = 1.2;
+    current[1].median_ms = 1.2;
+    benchmark_result added = { "find", "int", 4096, 10, 1.0, 1.0, 1.0, 0.0, 0.0 };
+    current.push_back(added);
+
+    const std::vector<benchmark_comparison> comparisons = compare_to_baseline(baseline, current, 0.1);
+
+    ASSERT_EQ(3, comparisons.size());
+    ASSERT_EQ(comparison_status::regressed, comparisons[0].status);
+    ASSERT_DOUBLE_EQ(1.2, comparisons[0].ratio);
+    ASSERT_EQ(comparison_status::ok, comparisons[1].status);
+    ASSERT_EQ(comparison_status::added, comparisons[2].status);
+    ASSERT_TRUE(has_regressions(comparisons));
+
+    current[0].median_ms = 0.5;
+    ASSERT_EQ(comparison_status::improved, compare_to_baseline(baseline, current, 0.1)[0].status);
+    ASSERT_FALSE(has_regressions(compare_to_baseline(baseline, current, 0.1)));
+}
+
+TEST_F(amp_benchmark_tests, compare_to_baseline_reports_missing_results)
+{
+    std::vector<benchmark_result> baseline;
+    benchmark_result reduce = { "reduce", "int", 4096, 10, 1.0, 1.0, 1.0, 0.0, 0.0 };
+    benchmark_result scan = { "scan_exclusive", "int", 4096, 10, 1.0, 1.0, 1.0, 0.0, 0.0 };
+    baseline.push_back(reduce);
+    baseline.push_back(scan);
+    std::vector<benchmark_result> current(1, reduce);
+
+    const std::vector<benchmark_comparison> comparisons = compare_to_baseline(baseline, current, 0.1);
+
+    ASSERT_EQ(2, comparisons.size());
+    ASSERT_EQ(comparison_status::ok, comparisons[0].status);
+    ASSERT_EQ(comparison_status::missing, comparisons[1].status);
+    ASSERT_EQ("scan_exclusive", comparisons[1].current.name);
+    ASSERT_FALSE(has_regressions(comparisons));
+    ASSERT_TRUE(has_failures(comparisons));
+
+    // A filtered run leaves out of the baseline the benchmarks it skips.
+    benchmark_config config;
+    config.filter = "reduce";
+    ASSERT_TRUE(matches_filter(config, "reduce", "int"));
+    ASSERT_FALSE(matches_filter(config, "scan_exclusive", "int"));
+}
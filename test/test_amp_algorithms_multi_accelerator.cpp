@@ -0,0 +1,149 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* C++ AMP standard algorithm library.
+*
+* This file contains unit tests.
+*---------------------------------------------------------------------------*/
+
+
+#include "stdafx.h"
+#include <amp_algorithms_multi_accelerator.h>
+
+#include "testtools.h"
+
+using namespace concurrency;
+using namespace amp_algorithms;
+using namespace testtools;
+
+// These run on several views of the default accelerator, which is enough to exercise the partitioning and 
+// carry logic on machines with a single device.
+
+class amp_multi_accelerator_tests : public testbase, public ::testing::TestWithParam<int>
+{
+protected:
+    accelerator_view_set targets;
+
+    amp_multi_accelerator_tests() : targets(make_views(), make_weights()) {}
+
+    static std::vector<accelerator_view> make_views()
+    {
+        std::vector<accelerator_view> views;
+        views.push_back(accelerator().default_view);
+        views.push_back(accelerator().create_view());
+        views.push_back(accelerator().create_view());
+        return views;
+    }
+
+    static std::vector<double> make_weights()
+    {
+        std::vector<double> weights;
+        weights.push_back(3.0);
+        weights.push_back(1.0);
+        weights.push_back(0.5);
+        return weights;
+    }
+};
+
+TEST_P(amp_multi_accelerator_tests, partition)
+{
+    const auto ranges = targets.partition(GetParam());
+
+    ASSERT_EQ(targets.size(), ranges.size());
+    int offset = 0;
+    for (const auto& r : ranges)
+    {
+        ASSERT_EQ(offset, r.first);
+        ASSERT_LE(0, r.second);
+        offset += r.second;
+    }
+    ASSERT_EQ(GetParam(), offset);
+}
+
+TEST_P(amp_multi_accelerator_tests, reduce)
+{
+    std::vector<int> input(GetParam());
+    generate_data(input);
+    array_view<const int> input_vw(static_cast<int>(input.size()), input);
+
+    ASSERT_EQ(std::accumulate(cbegin(input), cend(input), 0), amp_algorithms::reduce(targets, input_vw, amp_algorithms::plus<int>()));
+}
+
+TEST_P(amp_multi_accelerator_tests, transform)
+{
+    std::vector<int> input(GetParam());
+    generate_data(input);
+    array_view<const int> input_vw(static_cast<int>(input.size()), input);
+    std::vector<int> expected(input.size());
+    std::transform(cbegin(input), cend(input), begin(expected), [](int v) { return v * 2 + 1; });
+    std::vector<int> output(input.size(), -1);
+    array_view<int> output_vw(static_cast<int>(output.size()), output);
+
+    amp_algorithms::transform(targets, input_vw, output_vw, [](int v) restrict(amp) { return v * 2 + 1; });
+
+    ASSERT_TRUE(expected == output);
+}
+
+TEST_P(amp_multi_accelerator_tests, scan_exclusive)
+{
+    std::vector<int> input(GetParam());
+    generate_data(input);
+    std::vector<int> expected(input.size());
+    scan_cpu_exclusive(cbegin(input), cend(input), begin(expected), std::plus<int>());
+    array_view<int> input_vw(static_cast<int>(input.size()), input);
+
+    amp_algorithms::scan_exclusive(targets, input_vw, input_vw);
+
+    input_vw.synchronize();
+    ASSERT_TRUE(expected == input);
+}
+
+TEST_P(amp_multi_accelerator_tests, scan_inclusive)
+{
+    std::vector<int> input(GetParam());
+    generate_data(input);
+    std::vector<int> expected(input.size());
+    scan_cpu_inclusive(cbegin(input), cend(input), begin(expected), std::plus<int>());
+    array_view<int> input_vw(static_cast<int>(input.size()), input);
+    std::vector<int> output(input.size(), -1);
+    array_view<int> output_vw(static_cast<int>(output.size()), output);
+
+    amp_algorithms::scan_inclusive(targets, input_vw, output_vw);
+
+    ASSERT_TRUE(expected == output);
+}
+
+INSTANTIATE_TEST_CASE_P(amp_multi_accelerator_tests, amp_multi_accelerator_tests, ::testing::Values(1, 3, 1023, 70001));
+
+TEST(amp_accelerator_view_set_tests, invalid_weights)
+{
+    std::vector<accelerator_view> views(1, accelerator().default_view);
+
+    ASSERT_THROW(accelerator_view_set(std::vector<accelerator_view>()), runtime_exception);
+    ASSERT_THROW(accelerator_view_set(views, std::vector<double>(2, 1.0)), runtime_exception);
+    ASSERT_THROW(accelerator_view_set(views, std::vector<double>(1, 0.0)), runtime_exception);
+    ASSERT_THROW(accelerator_view_set(views, std::vector<double>(1, -1.0)), runtime_exception);
+}
+
+TEST(amp_accelerator_view_set_tests, calibrate)
+{
+    accelerator_view_set targets(std::vector<accelerator_view>(2, accelerator().default_view));
+
+    targets.calibrate(1 << 16);
+
+    ASSERT_LT(0.0, targets.weight(0));
+    ASSERT_LT(0.0, targets.weight(1));
+}
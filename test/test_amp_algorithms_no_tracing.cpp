@@ -0,0 +1,68 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* C++ AMP standard algorithm library.
+*
+* This file contains unit tests.
+*---------------------------------------------------------------------------*/
+
+// The test project defines AMP_ALGORITHMS_ENABLE_TRACING for every file. This one builds the library without 
+// it, so that the no-op hooks are compiled too. Kernels and spans instantiated here are unique to this file, 
+// since they are named after the lambdas passed in, and must not show up in the trace.
+
+#include "stdafx.h"
+
+#undef AMP_ALGORITHMS_ENABLE_TRACING
+#include <amp_algorithms.h>
+#include <amp_stl_algorithms.h>
+
+#include "testtools.h"
+
+using namespace concurrency;
+using namespace amp_algorithms;
+using namespace testtools;
+
+class amp_no_tracing_tests : public testbase, public ::testing::Test
+{
+protected:
+    ~amp_no_tracing_tests()
+    {
+        stop_tracing();
+    }
+};
+
+TEST_F(amp_no_tracing_tests, algorithms_run_without_hooks)
+{
+    std::vector<int> input(1024);
+    array_view<int> input_av(int(input.size()), input);
+    std::vector<int> output(input.size());
+    array_view<int> output_av(int(output.size()), output);
+
+    start_tracing();
+    amp_algorithms::generate(input_av, []() restrict(amp) { return 1; });
+    amp_algorithms::transform(input_av, output_av, [](int v) restrict(amp) { return 3 * v; });
+    const int sum = amp_algorithms::reduce(output_av, [](int a, int b) restrict(cpu, amp) { return a + b; });
+    const auto count = amp_stl_algorithms::count_if(begin(output_av), end(output_av), [](const int& v) restrict(amp) { return v == 3; });
+    stop_tracing();
+
+    ASSERT_EQ(3 * static_cast<int>(input.size()), sum);
+    ASSERT_EQ(static_cast<int>(input.size()), count);
+    const auto events = get_trace_events();
+    ASSERT_EQ(0, std::count_if(cbegin(events), cend(events), [](const trace_event& e) 
+    { 
+        return (e.category == trace_category::algorithm) || (e.category == trace_category::kernel); 
+    }));
+}
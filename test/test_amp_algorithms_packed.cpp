@@ -0,0 +1,170 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+* C++ AMP standard algorithm library.
+*
+* This file contains unit tests.
+*---------------------------------------------------------------------------*/
+
+#include "stdafx.h"
+#include <amp_algorithms.h>
+
+#include "testtools.h"
+
+using namespace concurrency;
+using namespace amp_algorithms;
+using namespace testtools;
+
+// Random elements followed by zeros up to the end of the last word. Sizes that are not a multiple of the 
+// elements per word leave part of the last word unused.
+template <typename T>
+std::vector<T> generate_packed_data(const int size, const int word_count)
+{
+    std::vector<int> values(size);
+    generate_data(values);
+    std::vector<T> data(word_count * packed_array_view<T>::elements_per_word, T(0));
+    std::transform(cbegin(values), cend(values), begin(data), [](int v) { return static_cast<T>((std::abs(v) * 2654435761u) >> 7); });
+    return data;
+}
+
+class amp_packed_tests : public testbase, public ::testing::Test {};
+
+class amp_packed_size_tests : public testbase, public ::testing::TestWithParam<int> {};
+
+TEST_F(amp_packed_tests, packed_array_view_element_access)
+{
+    std::vector<unsigned char> data(8, 0);
+    packed_array_view<unsigned char> data_vw(data);
+    std::vector<int> input(8);
+    std::iota(begin(input), end(input), 250);
+    array_view<const int> input_vw(int(input.size()), input);
+
+    // Neighboring threads write elements in the same word. Values are truncated to 8 bits.
+    amp_algorithms::transform(input_vw, data_vw, [](int v) restrict(amp) { return v; });
+    data_vw.synchronize();
+
+    ASSERT_EQ(8, data_vw.extent.size());
+    ASSERT_EQ(2, data_vw.word_count());
+    ASSERT_EQ(std::vector<unsigned char>({ 250, 251, 252, 253, 254, 255, 0, 1 }), data);
+    data_vw[concurrency::index<1>(7)] = 7;
+    ASSERT_EQ(7, data[7]);
+    ASSERT_EQ(255u, static_cast<unsigned int>(data_vw[concurrency::index<1>(5)]));
+}
+
+TEST_F(amp_packed_tests, packed_array_view_invalid_size)
+{
+    std::vector<unsigned char> data(5);
+    std::vector<unsigned int> words(2);
+    array_view<unsigned int> words_vw(2, words);
+
+    ASSERT_THROW(packed_array_view<unsigned char> data_vw(data), runtime_exception);
+    ASSERT_THROW((packed_array_view<unsigned short>(words_vw, 5)), runtime_exception);
+}
+
+TEST_P(amp_packed_size_tests, transform_uint8)
+{
+    const int size = GetParam();
+    std::vector<unsigned char> input = generate_packed_data<unsigned char>(size, (size + 3) / 4);
+    std::vector<unsigned int> output((size + 3) / 4, 0);
+    packed_array_view<unsigned char> input_vw(input);
+    packed_array_view<unsigned char> output_vw(array_view<unsigned int>(int(output.size()), output), size);
+
+    amp_algorithms::transform(input_vw, output_vw, [](unsigned int v) restrict(amp) { return 255 - v; });
+    output_vw.synchronize();
+
+    for (int i = 0; i < size; ++i)
+    {
+        ASSERT_EQ(255u - input[i], static_cast<unsigned int>(output_vw[concurrency::index<1>(i)])) << "at index " << i;
+    }
+}
+
+TEST_F(amp_packed_tests, transform_rejects_mismatched_sizes)
+{
+    std::vector<unsigned char> input(8, 1);
+    std::vector<unsigned char> output(12, 0);
+    packed_array_view<unsigned char> input_vw(input);
+    packed_array_view<unsigned char> output_vw(output);
+
+    ASSERT_THROW(amp_algorithms::transform(input_vw, output_vw, [](unsigned int v) restrict(amp) { return v; }), runtime_exception);
+}
+
+TEST_P(amp_packed_size_tests, reduce_and_count_if_uint16)
+{
+    const int size = GetParam();
+    std::vector<unsigned short> input = generate_packed_data<unsigned short>(size, (size + 1) / 2);
+    std::vector<unsigned int> words((size + 1) / 2);
+    std::copy_n(reinterpret_cast<const unsigned int*>(input.data()), words.size(), begin(words));
+    const packed_array_view<unsigned short> input_vw(array_view<unsigned int>(int(words.size()), words), size);
+    const auto first = cbegin(input);
+    const auto last = cbegin(input) + size;
+
+    const unsigned int sum = amp_algorithms::reduce(input_vw, amp_algorithms::plus<unsigned int>());
+    const unsigned int maximum = amp_algorithms::reduce(input_vw, amp_algorithms::max<unsigned int>());
+    const int odd_count = amp_algorithms::count_if(input_vw, [](unsigned int v) restrict(amp) { return (v & 1) != 0; });
+
+    ASSERT_EQ(std::accumulate(first, last, 0u), sum);
+    ASSERT_EQ(static_cast<unsigned int>(*std::max_element(first, last)), maximum);
+    ASSERT_EQ(static_cast<int>(std::count_if(first, last, [](unsigned short v) { return (v & 1) != 0; })), odd_count);
+}
+
+TEST_P(amp_packed_size_tests, histogram)
+{
+    const int size = GetParam();
+    std::vector<unsigned char> bytes = generate_packed_data<unsigned char>(size, (size + 3) / 4);
+    std::vector<unsigned short> shorts = generate_packed_data<unsigned short>(size, (size + 1) / 2);
+    std::vector<unsigned int> byte_bins(256, 7);
+    array_view<unsigned int> byte_bins_vw(256, byte_bins);
+    std::vector<unsigned int> short_bins(65536, 7);
+    array_view<unsigned int> short_bins_vw(65536, short_bins);
+    std::vector<unsigned int> expected_byte_bins(256, 0);
+    std::vector<unsigned int> expected_short_bins(65536, 0);
+    std::for_each(cbegin(bytes), cbegin(bytes) + size, [&](unsigned char v) { ++expected_byte_bins[v]; });
+    std::for_each(cbegin(shorts), cbegin(shorts) + size, [&](unsigned short v) { ++expected_short_bins[v]; });
+    std::vector<unsigned int> words((size + 3) / 4);
+    std::copy_n(reinterpret_cast<const unsigned int*>(bytes.data()), words.size(), begin(words));
+
+    amp_algorithms::histogram(packed_array_view<unsigned char>(array_view<unsigned int>(int(words.size()), words), size), byte_bins_vw);
+    amp_algorithms::histogram(packed_array_view<unsigned short>(shorts), short_bins_vw);
+    expected_short_bins[0] += static_cast<unsigned int>(shorts.size()) - size;
+
+    ASSERT_TRUE(are_equal(expected_byte_bins, byte_bins_vw));
+    ASSERT_TRUE(are_equal(expected_short_bins, short_bins_vw));
+}
+
+TEST_P(amp_packed_size_tests, radix_sort)
+{
+    const int size = GetParam();
+    std::vector<unsigned char> bytes = generate_packed_data<unsigned char>(size, (size + 3) / 4);
+    std::vector<unsigned short> shorts = generate_packed_data<unsigned short>(size, (size + 1) / 2);
+    std::vector<unsigned short> sorted_shorts(shorts.size(), 0);
+    std::vector<unsigned char> expected_bytes(bytes);
+    std::vector<unsigned short> expected_shorts(shorts);
+    std::sort(begin(expected_bytes), end(expected_bytes));
+    std::sort(begin(expected_shorts), end(expected_shorts));
+    packed_array_view<unsigned char> bytes_vw(bytes);
+    packed_array_view<unsigned short> shorts_vw(shorts);
+    packed_array_view<unsigned short> sorted_shorts_vw(sorted_shorts);
+
+    amp_algorithms::radix_sort(bytes_vw);
+    amp_algorithms::radix_sort(shorts_vw, sorted_shorts_vw);
+    bytes_vw.synchronize();
+    sorted_shorts_vw.synchronize();
+
+    ASSERT_EQ(expected_bytes, bytes);
+    ASSERT_EQ(expected_shorts, sorted_shorts);
+}
+
+INSTANTIATE_TEST_CASE_P(amp_packed_tests, amp_packed_size_tests, ::testing::Values(1, 1023, 4096, 70001));
@@ -0,0 +1,144 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+* C++ AMP standard algorithm library.
+*
+* This file contains unit tests.
+*---------------------------------------------------------------------------*/
+
+#include "stdafx.h"
+#include <amp_algorithms_pipeline.h>
+
+#include "testtools.h"
+
+using namespace concurrency;
+using namespace amp_algorithms;
+using namespace testtools;
+
+class amp_pipeline_tests : public testbase, public ::testing::Test {};
+
+TEST_F(amp_pipeline_tests, transformed_reduced)
+{
+    std::vector<int> input(1023);
+    generate_data(input);
+    array_view<const int> input_av(int(input.size()), input);
+    const int expected = std::accumulate(cbegin(input), cend(input), 0, [](int a, int x) { return a + 2 * x; });
+
+    const int result = input_av | transformed([](int x) restrict(amp) { return 2 * x; }) | reduced(amp_algorithms::plus<int>());
+
+    ASSERT_EQ(expected, result);
+}
+
+TEST_F(amp_pipeline_tests, filtered_transformed_reduced)
+{
+    std::vector<int> input(70001);
+    generate_data(input);
+    array_view<const int> input_av(int(input.size()), input);
+    int expected = 0;
+    for (auto x : input)
+    {
+        if ((x % 3) == 0)
+        {
+            expected += x / 3;
+        }
+    }
+
+    const int result = input_av
+        | filtered([](int x) restrict(amp) { return (x % 3) == 0; })
+        | transformed([](int x) restrict(amp) { return x / 3; })
+        | reduced(amp_algorithms::plus<int>());
+
+    ASSERT_EQ(expected, result);
+}
+
+TEST_F(amp_pipeline_tests, reduced_with_identity)
+{
+    std::vector<int> input(4096);
+    generate_data(input);
+    array_view<const int> input_av(int(input.size()), input);
+    int expected = std::numeric_limits<int>::max();
+    for (auto x : input)
+    {
+        if (x > 0)
+        {
+            expected = std::min(expected, x);
+        }
+    }
+
+    const int result = input_av
+        | filtered([](int x) restrict(amp) { return x > 0; })
+        | reduced(amp_algorithms::min<int>(), std::numeric_limits<int>::max());
+
+    ASSERT_EQ(expected, result);
+}
+
+TEST_F(amp_pipeline_tests, counted)
+{
+    std::vector<int> input(5000);
+    generate_data(input);
+    array_view<const int> input_av(int(input.size()), input);
+    const int expected = static_cast<int>(std::count_if(cbegin(input), cend(input), [](int x) { return ((x + 1) % 4) == 0; }));
+
+    const int result = input_av
+        | transformed([](int x) restrict(amp) { return x + 1; })
+        | filtered([](int x) restrict(amp) { return (x % 4) == 0; })
+        | counted();
+
+    ASSERT_EQ(expected, result);
+}
+
+TEST_F(amp_pipeline_tests, functor_view_source)
+{
+    const int size = 1000;
+    auto squares = make_indexable_view(concurrency::extent<1>(size), [](const concurrency::index<1>& idx) restrict(cpu, amp) { return idx[0] * idx[0]; });
+    int expected = 0;
+    for (int i = 0; i < size; i += 2)
+    {
+        expected += i * i;
+    }
+
+    const int result = squares | filtered([](int x) restrict(amp) { return (x % 2) == 0; }) | reduced(amp_algorithms::plus<int>());
+
+    ASSERT_EQ(expected, result);
+}
+
+TEST_F(amp_pipeline_tests, empty_input_returns_identity)
+{
+    std::vector<int> input(1, 5);
+    array_view<const int> input_av = array_view<const int>(int(input.size()), input).section(0, 0);
+
+    ASSERT_EQ(-1, as_pipeline(input_av).reduce(accelerator().default_view, amp_algorithms::plus<int>(), -1));
+    ASSERT_EQ(0, input_av | counted());
+}
+
+TEST_F(amp_pipeline_tests, runs_a_single_kernel)
+{
+    // transform | filter | transform | reduce fuses into the one reduction kernel.
+    std::vector<int> input(1024, 1);
+    array_view<const int> input_av(int(input.size()), input);
+
+    start_tracing(true);
+    const int result = input_av
+        | transformed([](int x) restrict(amp) { return x + 1; })
+        | filtered([](int x) restrict(amp) { return x > 0; })
+        | transformed([](int x) restrict(amp) { return x * 3; })
+        | reduced(amp_algorithms::plus<int>());
+    stop_tracing();
+
+    ASSERT_EQ(1024 * 6, result);
+    const auto events = get_trace_events();
+    ASSERT_EQ(1, std::count_if(cbegin(events), cend(events), [](const trace_event& e) { return e.category == trace_category::kernel; }));
+}
@@ -521,6 +521,21 @@ TEST_F(amp_algorithms_radix_sort_tests, radix_sort_with_data_16)
     ASSERT_TRUE(are_equal(sorted_by_key_1, output_av));
 }
 
+TEST_F(amp_algorithms_radix_sort_tests, radix_sort_async_with_data_16)
+{
+    std::array<int, 16> input =                              { 3,  2,  1,  6,   10, 11, 13,  0,   15, 10,  5, 14,    4, 12,  9,  8 };
+    std::array<int, 16> expected =                           { 0,  1,  2,  3,    4,  5,  6,  8,    9, 10, 10, 11,   12, 13, 14, 15 };
+
+    concurrency::array_view<int, 1> input_vw(static_cast<int>(input.size()), input);
+    std::vector<int> output(input.size(), 404);
+    array_view<int> output_av(static_cast<int>(output.size()), output);
+
+    radix_sort_async(input_vw, output_av).wait();
+
+    output_av.synchronize();
+    ASSERT_TRUE(are_equal(expected, output_av));
+}
+
 //----------------------------------------------------------------------------
 // Public API Acceptance Tests
 //----------------------------------------------------------------------------
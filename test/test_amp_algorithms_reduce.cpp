@@ -87,6 +87,512 @@ TEST_F(amp_reduce_tests, functor_view_int)
     ASSERT_TRUE(compare(gpuStdDev, cpuStdDev));
 }
 
+TEST_F(amp_reduce_tests, transform_reduce_sum_of_squares)
+{
+    std::vector<int> input(7919);
+    generate_data(input);
+    std::transform(cbegin(input), cend(input), begin(input), [](int v) { return v % 100; });
+    array_view<const int> input_vw(static_cast<int>(input.size()), input);
+    int expected = std::accumulate(cbegin(input), cend(input), 0, [](int sum, int v) { return sum + v * v; });
+
+    int r = amp_algorithms::transform_reduce(input_vw, [](const int& v) restrict(cpu, amp) { return v * v; }, amp_algorithms::plus<int>());
+
+    ASSERT_EQ(expected, r);
+}
+
+TEST_F(amp_reduce_tests, describe_float)
+{
+    std::vector<float> input(7919);
+    generate_data(input);
+    array_view<const float> input_vw(static_cast<int>(input.size()), input);
+    const float expected_sum = std::accumulate(cbegin(input), cend(input), 0.0f);
+    const float expected_sum_of_squares = std::accumulate(cbegin(input), cend(input), 0.0f, [](float sum, float v) { return sum + v * v; });
+
+    auto r = amp_algorithms::describe(input_vw);
+
+    ASSERT_EQ(static_cast<int>(input.size()), r.count);
+    ASSERT_TRUE(compare(expected_sum, r.sum));
+    ASSERT_TRUE(compare(expected_sum_of_squares, r.sum_of_squares));
+    ASSERT_EQ(*std::min_element(cbegin(input), cend(input)), r.minimum);
+    ASSERT_EQ(*std::max_element(cbegin(input), cend(input)), r.maximum);
+    ASSERT_TRUE(compare(expected_sum / input.size(), r.mean()));
+}
+
+TEST_F(amp_reduce_tests, describe_variance_with_large_mean)
+{
+    // The spread is tiny compared to the mean, so E[x^2] - E[x]^2 in float would lose every significant digit.
+    std::vector<float> input(7919);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = 10000.0f + static_cast<float>(i % 100) / 100.0f;
+    }
+    array_view<const float> input_vw(static_cast<int>(input.size()), input);
+    const double expected_mean = std::accumulate(cbegin(input), cend(input), 0.0) / input.size();
+    const double expected_variance = std::accumulate(cbegin(input), cend(input), 0.0, 
+        [=](double sum, float v) { return sum + (v - expected_mean) * (v - expected_mean); }) / input.size();
+
+    auto r = amp_algorithms::describe(input_vw);
+
+    ASSERT_TRUE(compare(static_cast<float>(expected_mean), r.mean()));
+    ASSERT_TRUE(compare(static_cast<float>(expected_variance), r.variance(), 0.00005f, 0.01f));
+}
+
+TEST_F(amp_reduce_tests, describe_int)
+{
+    std::vector<int> input(1283);
+    generate_data(input);
+    std::transform(cbegin(input), cend(input), begin(input), [](int v) { return (v % 200) - 100; });
+    array_view<const int> input_vw(static_cast<int>(input.size()), input);
+
+    auto r = amp_algorithms::describe(accelerator().default_view, input_vw);
+
+    ASSERT_EQ(static_cast<int>(input.size()), r.count);
+    ASSERT_EQ(std::accumulate(cbegin(input), cend(input), 0), r.sum);
+    ASSERT_EQ(std::accumulate(cbegin(input), cend(input), 0, [](int sum, int v) { return sum + v * v; }), r.sum_of_squares);
+    ASSERT_EQ(*std::min_element(cbegin(input), cend(input)), r.minimum);
+    ASSERT_EQ(*std::max_element(cbegin(input), cend(input)), r.maximum);
+    ASSERT_TRUE(compare(static_cast<float>(std::accumulate(cbegin(input), cend(input), 0)) / input.size(), r.mean(), 0.001f, 0.0025f));
+}
+
+TEST_F(amp_reduce_tests, reduce_rank_2_rows_and_columns)
+{
+    const int rows = 37;
+    const int cols = 1283;
+    std::vector<int> input(rows * cols);
+    generate_data(input);
+    std::transform(cbegin(input), cend(input), begin(input), [](int v) { return v % 100; });
+    array_view<const int, 2> input_vw(rows, cols, input);
+    std::vector<int> row_sums(rows, -1);
+    array_view<int> row_sums_vw(rows, row_sums);
+    std::vector<int> col_sums(cols, -1);
+    array_view<int> col_sums_vw(cols, col_sums);
+
+    amp_algorithms::reduce(input_vw, 1, amp_algorithms::plus<int>(), row_sums_vw);
+    amp_algorithms::reduce(input_vw, 0, amp_algorithms::plus<int>(), col_sums_vw);
+
+    std::vector<int> expected_row_sums(rows, 0);
+    std::vector<int> expected_col_sums(cols, 0);
+    for (int r = 0; r < rows; ++r)
+    {
+        for (int c = 0; c < cols; ++c)
+        {
+            expected_row_sums[r] += input[r * cols + c];
+            expected_col_sums[c] += input[r * cols + c];
+        }
+    }
+    ASSERT_TRUE(are_equal(expected_row_sums, row_sums_vw));
+    ASSERT_TRUE(are_equal(expected_col_sums, col_sums_vw));
+}
+
+TEST_F(amp_reduce_tests, reduce_rank_3_each_axis)
+{
+    const concurrency::extent<3> ext(5, 7, 300);
+    std::vector<int> input(ext.size());
+    generate_data(input);
+    array_view<const int, 3> input_vw(ext, input);
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const concurrency::extent<2> output_ext = (axis == 0) ? concurrency::extent<2>(ext[1], ext[2]) :
+            (axis == 1) ? concurrency::extent<2>(ext[0], ext[2]) : concurrency::extent<2>(ext[0], ext[1]);
+        std::vector<int> output(output_ext.size(), -1);
+        array_view<int, 2> output_vw(output_ext, output);
+        std::vector<int> expected(output_ext.size(), std::numeric_limits<int>::min());
+
+        amp_algorithms::reduce(input_vw, axis, amp_algorithms::max<int>(), output_vw);
+
+        for (int i = 0; i < ext[0]; ++i)
+        {
+            for (int j = 0; j < ext[1]; ++j)
+            {
+                for (int k = 0; k < ext[2]; ++k)
+                {
+                    const int o = (axis == 0) ? (j * ext[2] + k) : (axis == 1) ? (i * ext[2] + k) : (i * ext[1] + j);
+                    expected[o] = std::max(expected[o], input[(i * ext[1] + j) * ext[2] + k]);
+                }
+            }
+        }
+        output_vw.synchronize();
+        ASSERT_TRUE(are_equal(expected, output));
+    }
+}
+
+TEST_F(amp_reduce_tests, reduce_rank_2_transposed_view)
+{
+    // Reducing along axis 0 of a transposed view reads contiguous rows of the underlying matrix.
+    const int rows = 37;
+    const int cols = 1283;
+    std::vector<int> input(rows * cols);
+    generate_data(input);
+    std::transform(cbegin(input), cend(input), begin(input), [](int v) { return v % 100; });
+    array_view<const int, 2> input_vw(rows, cols, input);
+    const auto transposed_vw = make_transposed_view(input_vw);
+    std::vector<int> row_sums(rows, -1);
+    array_view<int> row_sums_vw(rows, row_sums);
+    std::vector<int> col_sums(cols, -1);
+    array_view<int> col_sums_vw(cols, col_sums);
+
+    amp_algorithms::reduce(transposed_vw, 0, amp_algorithms::plus<int>(), row_sums_vw);
+    amp_algorithms::reduce(transposed_vw, 1, amp_algorithms::plus<int>(), col_sums_vw);
+
+    std::vector<int> expected_row_sums(rows, 0);
+    std::vector<int> expected_col_sums(cols, 0);
+    for (int r = 0; r < rows; ++r)
+    {
+        for (int c = 0; c < cols; ++c)
+        {
+            expected_row_sums[r] += input[r * cols + c];
+            expected_col_sums[c] += input[r * cols + c];
+        }
+    }
+    ASSERT_TRUE(are_equal(expected_row_sums, row_sums_vw));
+    ASSERT_TRUE(are_equal(expected_col_sums, col_sums_vw));
+}
+
+TEST_F(amp_reduce_tests, reduce_rank_2_long_strided_axis)
+{
+    // A reduced axis longer than a tile has rows, and a number of columns that does not fill a tile.
+    const int rows = 1000;
+    const int cols = 45;
+    std::vector<int> input(rows * cols);
+    generate_data(input);
+    std::transform(cbegin(input), cend(input), begin(input), [](int v) { return v % 100; });
+    array_view<const int, 2> input_vw(rows, cols, input);
+    std::vector<int> col_sums(cols, -1);
+    array_view<int> col_sums_vw(cols, col_sums);
+
+    amp_algorithms::reduce(input_vw, 0, amp_algorithms::plus<int>(), col_sums_vw);
+
+    std::vector<int> expected_col_sums(cols, 0);
+    for (int r = 0; r < rows; ++r)
+    {
+        for (int c = 0; c < cols; ++c)
+        {
+            expected_col_sums[c] += input[r * cols + c];
+        }
+    }
+    ASSERT_TRUE(are_equal(expected_col_sums, col_sums_vw));
+}
+
+TEST_F(amp_reduce_tests, reduce_axis_rejects_mismatched_output)
+{
+    std::vector<int> input(6 * 4, 1);
+    array_view<const int, 2> input_vw(6, 4, input);
+    std::vector<int> output(6, 0);
+    array_view<int> output_vw(6, output);
+
+    ASSERT_THROW(amp_algorithms::reduce(input_vw, 0, amp_algorithms::plus<int>(), output_vw), runtime_exception);
+    ASSERT_THROW(amp_algorithms::reduce(input_vw, 2, amp_algorithms::plus<int>(), output_vw), runtime_exception);
+}
+
+class amp_segmented_reduce_tests : public testbase, public ::testing::TestWithParam<int> {};
+
+TEST_P(amp_segmented_reduce_tests, segmented_reduce)
+{
+    // Segment lengths vary around the parameter and include empty segments.
+    const int average_length = GetParam();
+    std::vector<int> offsets(1, 0);
+    for (int s = 0; s < 3000; ++s)
+    {
+        offsets.push_back(offsets.back() + (((s % 7) == 3) ? 0 : (s * 7919) % (2 * average_length + 1)));
+    }
+    const int segment_count = static_cast<int>(offsets.size()) - 1;
+    std::vector<int> input(offsets.back());
+    generate_data(input);
+    std::transform(cbegin(input), cend(input), begin(input), [](int v) { return v % 100; });
+    array_view<const int> input_vw(static_cast<int>(input.size()), input);
+    array_view<const int> offsets_vw(static_cast<int>(offsets.size()), offsets);
+    std::vector<int> output(segment_count, -1);
+    array_view<int> output_vw(segment_count, output);
+    std::vector<int> expected(segment_count, -1);
+    for (int s = 0; s < segment_count; ++s)
+    {
+        if (offsets[s] != offsets[s + 1])
+        {
+            expected[s] = std::accumulate(cbegin(input) + offsets[s], cbegin(input) + offsets[s + 1], 0);
+        }
+    }
+
+    amp_algorithms::segmented_reduce(input_vw, offsets_vw, amp_algorithms::plus<int>(), output_vw);
+
+    ASSERT_TRUE(are_equal(expected, output_vw));
+}
+
+INSTANTIATE_TEST_CASE_P(amp_reduce_tests, amp_segmented_reduce_tests, ::testing::Values(1, 5, 100, 3000));
+
+TEST_F(amp_reduce_tests, segmented_reduce_mixed_lengths)
+{
+    // Mostly short segments with a few long and medium ones, so each is reduced by a different number of threads.
+    std::vector<int> offsets(1, 0);
+    for (int s = 0; s < 5000; ++s)
+    {
+        offsets.push_back(offsets.back() + (((s % 1000) == 17) ? 20000 : (((s % 50) == 3) ? 300 : (s % 4))));
+    }
+    const int segment_count = static_cast<int>(offsets.size()) - 1;
+    std::vector<int> input(offsets.back());
+    generate_data(input);
+    std::transform(cbegin(input), cend(input), begin(input), [](int v) { return v % 100; });
+    array_view<const int> input_vw(static_cast<int>(input.size()), input);
+    array_view<const int> offsets_vw(static_cast<int>(offsets.size()), offsets);
+    std::vector<int> output(segment_count, -1);
+    array_view<int> output_vw(segment_count, output);
+    std::vector<int> expected(segment_count, -1);
+    for (int s = 0; s < segment_count; ++s)
+    {
+        if (offsets[s] != offsets[s + 1])
+        {
+            expected[s] = std::accumulate(cbegin(input) + offsets[s], cbegin(input) + offsets[s + 1], 0);
+        }
+    }
+
+    amp_algorithms::segmented_reduce(input_vw, offsets_vw, amp_algorithms::plus<int>(), output_vw);
+
+    ASSERT_TRUE(are_equal(expected, output_vw));
+}
+
+TEST_F(amp_reduce_tests, segmented_reduce_does_not_read_back)
+{
+    // Segments of all three lengths, none of which may make the host wait for the accelerator.
+    const int lengths[] = { 3, 0, 200, 5000, 1, 40 };
+    std::vector<int> offsets(1, 0);
+    for (const int length : lengths)
+    {
+        offsets.push_back(offsets.back() + length);
+    }
+    std::vector<int> input(offsets.back(), 1);
+    array_view<const int> input_vw(static_cast<int>(input.size()), input);
+    array_view<const int> offsets_vw(static_cast<int>(offsets.size()), offsets);
+    std::vector<int> output(offsets.size() - 1, -1);
+    array_view<int> output_vw(static_cast<int>(output.size()), output);
+
+    start_tracing();
+    amp_algorithms::segmented_reduce(input_vw, offsets_vw, amp_algorithms::plus<int>(), output_vw);
+    stop_tracing();
+
+    const auto events = get_trace_events();
+    ASSERT_EQ(0, std::count_if(cbegin(events), cend(events), [](const trace_event& e) 
+    { 
+        return (e.category == trace_category::copy) || (e.category == trace_category::synchronize); 
+    }));
+    const std::vector<int> expected = { 3, -1, 200, 5000, 1, 40 };
+    ASSERT_TRUE(are_equal(expected, output_vw));
+}
+
+class amp_reproducible_reduce_tests : public testbase, public ::testing::TestWithParam<int> {};
+
+TEST_P(amp_reproducible_reduce_tests, reproducible_reduce_float)
+{
+    std::vector<float> input(GetParam());
+    generate_data(input);
+    array_view<const float> input_vw(static_cast<int>(input.size()), input);
+    const double expected = std::accumulate(cbegin(input), cend(input), 0.0);
+
+    const float r1 = amp_algorithms::reproducible_reduce(input_vw, amp_algorithms::plus<float>());
+    const float r2 = amp_algorithms::reproducible_reduce(accelerator().default_view, input_vw, amp_algorithms::plus<float>());
+
+    ASSERT_EQ(r1, r2);
+    ASSERT_TRUE(compare(static_cast<float>(expected), r1));
+}
+
+TEST_P(amp_reproducible_reduce_tests, reproducible_reduce_int)
+{
+    std::vector<int> input(GetParam());
+    generate_data(input);
+    array_view<const int> input_vw(static_cast<int>(input.size()), input);
+
+    ASSERT_EQ(std::accumulate(cbegin(input), cend(input), 0), amp_algorithms::reproducible_reduce(input_vw, amp_algorithms::plus<int>()));
+}
+
+INSTANTIATE_TEST_CASE_P(amp_reduce_tests, amp_reproducible_reduce_tests, ::testing::Values(1, 1023, 1024, 1025, 70001, 2000000));
+
+TEST_F(amp_reduce_tests, reduce_async)
+{
+    std::vector<int> input(70001);
+    generate_data(input);
+    array_view<const int> input_vw(static_cast<int>(input.size()), input);
+    array<int> sum(1);
+    array<int> sum_of_squares(1);
+
+    // Both reductions are queued before either result is read back.
+    auto sum_done = amp_algorithms::reduce_async(input_vw, amp_algorithms::plus<int>(), array_view<int>(sum));
+    auto sum_of_squares_done = amp_algorithms::transform_reduce_async(input_vw, [](int v) restrict(amp) { return v * v; }, 
+        amp_algorithms::plus<int>(), array_view<int>(sum_of_squares));
+    sum_done.wait();
+    sum_of_squares_done.wait();
+
+    std::vector<int> results(2);
+    copy(sum, begin(results));
+    copy(sum_of_squares, begin(results) + 1);
+    ASSERT_EQ(std::accumulate(cbegin(input), cend(input), 0), results[0]);
+    ASSERT_EQ(std::accumulate(cbegin(input), cend(input), 0, [](int a, int v) { return a + v * v; }), results[1]);
+}
+
+TEST_F(amp_reduce_tests, reduce_variants_async)
+{
+    std::vector<float> input(70001);
+    generate_data(input);
+    array_view<const float> input_vw(static_cast<int>(input.size()), input);
+    array<float> reproducible_sum(1);
+    array<neumaier_sum<float>> accumulated_sum(1);
+    array<descriptive_statistics<float>> statistics(1);
+
+    auto reproducible_done = amp_algorithms::reproducible_reduce_async(input_vw, amp_algorithms::plus<float>(), array_view<float>(reproducible_sum));
+    auto accumulated_done = amp_algorithms::accumulate_async(input_vw, amp_algorithms::plus<neumaier_sum<float>>(), 
+        array_view<neumaier_sum<float>>(accumulated_sum));
+    auto statistics_done = amp_algorithms::describe_async(input_vw, array_view<descriptive_statistics<float>>(statistics));
+    reproducible_done.wait();
+    accumulated_done.wait();
+    statistics_done.wait();
+
+    std::vector<float> sum(1);
+    copy(reproducible_sum, begin(sum));
+    ASSERT_EQ(amp_algorithms::reproducible_reduce(input_vw, amp_algorithms::plus<float>()), sum[0]);
+    std::vector<neumaier_sum<float>> accumulated(1);
+    copy(accumulated_sum, begin(accumulated));
+    ASSERT_TRUE(compare(static_cast<float>(std::accumulate(cbegin(input), cend(input), 0.0)), accumulated[0].value()));
+    std::vector<descriptive_statistics<float>> r(1);
+    copy(statistics, begin(r));
+    ASSERT_EQ(static_cast<int>(input.size()), r[0].count);
+    ASSERT_EQ(*std::min_element(cbegin(input), cend(input)), r[0].minimum);
+    ASSERT_EQ(*std::max_element(cbegin(input), cend(input)), r[0].maximum);
+}
+
+TEST_F(amp_reduce_tests, segmented_and_axis_reduce_async)
+{
+    const int rows = 37;
+    const int cols = 1283;
+    std::vector<int> input(rows * cols);
+    generate_data(input);
+    array_view<const int, 2> input_vw(rows, cols, input);
+    std::vector<int> offsets(rows + 1);
+    for (int r = 0; r <= rows; ++r)
+    {
+        offsets[r] = r * cols;
+    }
+    array_view<const int> offsets_vw(static_cast<int>(offsets.size()), offsets);
+    std::vector<int> row_sums(rows);
+    array_view<int> row_sums_vw(rows, row_sums);
+    std::vector<int> segment_sums(rows);
+    array_view<int> segment_sums_vw(rows, segment_sums);
+    std::vector<int> expected(rows);
+    for (int r = 0; r < rows; ++r)
+    {
+        expected[r] = std::accumulate(cbegin(input) + offsets[r], cbegin(input) + offsets[r + 1], 0);
+    }
+
+    // Each row is also a segment of the flattened input.
+    auto rows_done = amp_algorithms::reduce_async(input_vw, 1, amp_algorithms::plus<int>(), row_sums_vw);
+    auto segments_done = amp_algorithms::segmented_reduce_async(array_view<const int>(rows * cols, input), offsets_vw, 
+        amp_algorithms::plus<int>(), segment_sums_vw);
+    rows_done.wait();
+    segments_done.wait();
+
+    ASSERT_TRUE(are_equal(expected, row_sums_vw));
+    ASSERT_TRUE(are_equal(expected, segment_sums_vw));
+}
+
+TEST_F(amp_reduce_tests, reduce_host_dispatch)
+{
+    const int threshold = get_host_dispatch_threshold(host_dispatch_algorithm::reduce);
+    std::vector<int> input(100);
+    generate_data(input);
+    array_view<const int> input_vw(static_cast<int>(input.size()), input);
+    const int expected = std::accumulate(cbegin(input), cend(input), 0);
+
+    set_host_dispatch_threshold(host_dispatch_algorithm::reduce, 1000);
+    const int host_result = amp_algorithms::reduce(input_vw, amp_algorithms::plus<int>());
+    set_host_dispatch_threshold(host_dispatch_algorithm::reduce, 0);
+    const int accelerator_result = amp_algorithms::reduce(input_vw, amp_algorithms::plus<int>());
+    set_host_dispatch_threshold(host_dispatch_algorithm::reduce, threshold);
+
+    ASSERT_EQ(expected, host_result);
+    ASSERT_EQ(expected, accelerator_result);
+}
+
+TEST_F(amp_reduce_tests, reduce_host_dispatch_skips_accelerator_data)
+{
+    const int threshold = get_host_dispatch_threshold(host_dispatch_algorithm::reduce);
+    std::vector<int> input(100);
+    generate_data(input);
+    const array<int> input_array(static_cast<int>(input.size()), cbegin(input), cend(input));
+    array_view<const int> input_vw(input_array);
+
+    // The data is on the accelerator, so it is reduced there rather than copied back.
+    set_host_dispatch_threshold(host_dispatch_algorithm::reduce, 1000);
+    start_tracing(true);
+    const int result = amp_algorithms::reduce(input_vw, amp_algorithms::plus<int>());
+    stop_tracing();
+    set_host_dispatch_threshold(host_dispatch_algorithm::reduce, threshold);
+
+    ASSERT_EQ(std::accumulate(cbegin(input), cend(input), 0), result);
+    const auto events = get_trace_events();
+    ASSERT_LT(0, std::count_if(cbegin(events), cend(events), [](const trace_event& e) { return e.category == trace_category::kernel; }));
+}
+
+TEST_F(amp_reduce_tests, calibrate_host_dispatch)
+{
+    const host_dispatch_algorithm algorithms[] = { host_dispatch_algorithm::reduce, host_dispatch_algorithm::find, host_dispatch_algorithm::count };
+    std::vector<int> thresholds;
+    for (auto a : algorithms)
+    {
+        thresholds.push_back(get_host_dispatch_threshold(a));
+    }
+
+    calibrate_host_dispatch();
+
+    for (size_t i = 0; i < thresholds.size(); ++i)
+    {
+        EXPECT_LE(0, get_host_dispatch_threshold(algorithms[i]));
+        EXPECT_GE(_details::max_calibrated_host_dispatch_threshold, get_host_dispatch_threshold(algorithms[i]));
+        set_host_dispatch_threshold(algorithms[i], thresholds[i]);
+    }
+    ASSERT_THROW(set_host_dispatch_threshold(host_dispatch_algorithm::reduce, -1), runtime_exception);
+}
+
+TEST_F(amp_reduce_tests, accumulate_neumaier_sum)
+{
+    // Adding 1 to 1e8 in float is lost to rounding, so a plain float reduction of this data drifts towards zero.
+    std::vector<float> input(1 << 18);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = (i % 2 == 1) ? 1.0f : ((i % 4 == 0) ? 1e8f : -1e8f);
+    }
+    array_view<const float> input_vw(static_cast<int>(input.size()), input);
+
+    const auto result = amp_algorithms::accumulate<amp_algorithms::neumaier_sum<float>>(input_vw);
+
+    ASSERT_EQ(static_cast<float>(input.size() / 2), result.value());
+}
+
+TEST_F(amp_reduce_tests, accumulate_double)
+{
+    if (!accelerator().supports_limited_double_precision)
+    {
+        return;
+    }
+    std::vector<float> input(70001);
+    generate_data(input);
+    array_view<const float> input_vw(static_cast<int>(input.size()), input);
+    const double expected = std::accumulate(cbegin(input), cend(input), 0.0);
+
+    const double result = amp_algorithms::accumulate<double>(accelerator().default_view, input_vw, amp_algorithms::plus<double>());
+
+    ASSERT_TRUE(compare(static_cast<float>(expected), static_cast<float>(result)));
+}
+
+TEST_F(amp_reduce_tests, transform_reduce_count)
+{
+    std::vector<float> input(1283);
+    generate_data(input);
+    array_view<const float> input_vw(static_cast<int>(input.size()), input);
+    int expected = static_cast<int>(std::count_if(cbegin(input), cend(input), [](float v) { return v > 0.5f; }));
+
+    int r = amp_algorithms::transform_reduce(accelerator().default_view, input_vw, 
+        [](const float& v) restrict(cpu, amp) { return (v > 0.5f) ? 1 : 0; }, amp_algorithms::plus<int>());
+
+    ASSERT_EQ(expected, r);
+}
+
 //----------------------------------------------------------------------------
 // Public API Acceptance Tests
 //----------------------------------------------------------------------------
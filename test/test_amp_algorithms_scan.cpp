@@ -236,6 +236,89 @@ TEST_F(amp_algorithms_scan_tests, inclusive_recursive)
     ASSERT_TRUE(expected == input);
 }
 
+TEST_F(amp_algorithms_scan_tests, exclusive_and_inclusive_async)
+{
+    std::vector<int> input(test_tile_size * 10 + 3);
+    generate_data(input);
+    concurrency::array_view<int, 1> input_vw(static_cast<int>(input.size()), input);
+    std::vector<int> expected_exclusive(input.size());
+    scan_cpu_exclusive(cbegin(input), cend(input), begin(expected_exclusive), std::plus<int>());
+    std::vector<int> expected_inclusive(input.size());
+    scan_cpu_inclusive(cbegin(input), cend(input), begin(expected_inclusive), std::plus<int>());
+    std::vector<int> exclusive(input.size());
+    concurrency::array_view<int, 1> exclusive_vw(static_cast<int>(exclusive.size()), exclusive);
+    std::vector<int> inclusive(input.size());
+    concurrency::array_view<int, 1> inclusive_vw(static_cast<int>(inclusive.size()), inclusive);
+
+    auto exclusive_done = scan_exclusive_async(input_vw, exclusive_vw);
+    auto inclusive_done = scan_inclusive_async(input_vw, inclusive_vw);
+    exclusive_done.wait();
+    inclusive_done.wait();
+
+    exclusive_vw.synchronize();
+    inclusive_vw.synchronize();
+    ASSERT_TRUE(expected_exclusive == exclusive);
+    ASSERT_TRUE(expected_inclusive == inclusive);
+}
+
+TEST_F(amp_algorithms_scan_tests, scan_async_with_functor)
+{
+    std::vector<int> input(test_tile_size * 10 + 3);
+    generate_data(input);
+    concurrency::array_view<int, 1> input_vw(static_cast<int>(input.size()), input);
+    std::vector<int> expected(input.size());
+    scan_cpu_inclusive(cbegin(input), cend(input), begin(expected), [](int a, int b) { return std::max(a, b); });
+    std::vector<int> output(input.size());
+    concurrency::array_view<int, 1> output_vw(static_cast<int>(output.size()), output);
+
+    scan_async<test_tile_size, scan_mode::inclusive>(input_vw, output_vw, amp_algorithms::max<int>()).wait();
+
+    output_vw.synchronize();
+    ASSERT_TRUE(expected == output);
+}
+
+TEST_F(amp_algorithms_scan_tests, inclusive_neumaier_sum)
+{
+    std::vector<float> input(test_tile_size * 10 + 3);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = (i % 2 == 1) ? 1.0f : ((i % 4 == 0) ? 1e8f : -1e8f);
+    }
+    concurrency::array_view<const float, 1> input_vw(static_cast<int>(input.size()), input);
+    std::vector<double> exact(input.size());
+    scan_cpu_inclusive(cbegin(input), cend(input), begin(exact), std::plus<double>());
+    std::vector<float> expected(exact.size());
+    std::transform(cbegin(exact), cend(exact), begin(expected), [](double v) { return static_cast<float>(v); });
+    std::vector<float> output(input.size());
+    concurrency::array_view<float, 1> output_vw(static_cast<int>(output.size()), output);
+
+    scan_inclusive<neumaier_sum<float>>(input_vw, output_vw);
+
+    output_vw.synchronize();
+    ASSERT_TRUE(expected == output);
+}
+
+TEST_F(amp_algorithms_scan_tests, exclusive_neumaier_sum)
+{
+    std::vector<float> input(test_tile_size * 10 + 3);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = (i % 2 == 1) ? 1.0f : ((i % 4 == 0) ? 1e8f : -1e8f);
+    }
+    concurrency::array_view<const float, 1> input_vw(static_cast<int>(input.size()), input);
+    std::vector<double> exact(input.size());
+    scan_cpu_exclusive(cbegin(input), cend(input), begin(exact), std::plus<double>());
+    std::vector<float> expected(exact.size());
+    std::transform(cbegin(exact), cend(exact), begin(expected), [](double v) { return static_cast<float>(v); });
+    std::vector<float> output(input.size());
+    concurrency::array_view<float, 1> output_vw(static_cast<int>(output.size()), output);
+
+    scan_exclusive<neumaier_sum<float>>(concurrency::accelerator().default_view, input_vw, output_vw);
+
+    output_vw.synchronize();
+    ASSERT_TRUE(expected == output);
+}
+
 //----------------------------------------------------------------------------
 // Public API Acceptance Tests
 //----------------------------------------------------------------------------
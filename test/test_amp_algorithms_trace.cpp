@@ -0,0 +1,166 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* C++ AMP standard algorithm library.
+*
+* This file contains unit tests.
+*---------------------------------------------------------------------------*/
+
+// The test project defines AMP_ALGORITHMS_ENABLE_TRACING so that these tests see the hooks.
+
+#include "stdafx.h"
+#include <amp_algorithms.h>
+#include <amp_stl_algorithms.h>
+
+#include "testtools.h"
+
+using namespace concurrency;
+using namespace amp_algorithms;
+using namespace testtools;
+
+class amp_trace_tests : public testbase, public ::testing::Test
+{
+protected:
+    ~amp_trace_tests()
+    {
+        stop_tracing();
+        set_trace_sink(trace_sink());
+    }
+
+    static std::vector<trace_event> find_events(const std::vector<trace_event>& events, const trace_category category)
+    {
+        std::vector<trace_event> found;
+        std::copy_if(cbegin(events), cend(events), std::back_inserter(found), [=](const trace_event& e) { return e.category == category; });
+        return found;
+    }
+};
+
+TEST_F(amp_trace_tests, records_nothing_when_not_tracing)
+{
+    std::vector<int> input(1024, 1);
+    array_view<const int> input_av(int(input.size()), input);
+
+    start_tracing();
+    stop_tracing();
+    amp_algorithms::reduce(input_av, amp_algorithms::plus<int>());
+
+    ASSERT_TRUE(get_trace_events().empty());
+}
+
+TEST_F(amp_trace_tests, transform_records_algorithm_and_kernel)
+{
+    std::vector<int> input(1024, 1);
+    std::vector<int> output(1024, 0);
+    array_view<const int> input_av(int(input.size()), input);
+    array_view<int> output_av(int(output.size()), output);
+
+    start_tracing(true);
+    amp_algorithms::transform(input_av, output_av, [](int x) restrict(amp) { return x + 1; });
+    stop_tracing();
+
+    const auto events = get_trace_events();
+    const auto algorithms = find_events(events, trace_category::algorithm);
+    const auto kernels = find_events(events, trace_category::kernel);
+    ASSERT_EQ(1, algorithms.size());
+    ASSERT_EQ(1, kernels.size());
+    ASSERT_NE(std::string::npos, algorithms[0].name.find("transform"));
+    ASSERT_EQ(std::vector<int>(1, 1024), kernels[0].extent);
+    ASSERT_TRUE(kernels[0].tile.empty());
+
+    // The kernel runs within the algorithm's span.
+    ASSERT_LE(algorithms[0].start_us, kernels[0].start_us);
+    ASSERT_GE(algorithms[0].start_us + algorithms[0].duration_us, kernels[0].start_us + kernels[0].duration_us);
+}
+
+TEST_F(amp_trace_tests, scan_records_tile_size)
+{
+    std::vector<int> input(4096, 1);
+    std::vector<int> output(4096, 0);
+    array_view<const int> input_av(int(input.size()), input);
+    array_view<int> output_av(int(output.size()), output);
+
+    start_tracing();
+    amp_algorithms::scan_exclusive(input_av, output_av);
+    stop_tracing();
+
+    const auto kernels = find_events(get_trace_events(), trace_category::kernel);
+    ASSERT_FALSE(kernels.empty());
+    ASSERT_TRUE(std::any_of(cbegin(kernels), cend(kernels), [](const trace_event& e) 
+    { 
+        return e.tile == std::vector<int>(1, _details::scan_default_tile_size); 
+    }));
+}
+
+TEST_F(amp_trace_tests, stl_copy_records_bytes)
+{
+    std::vector<int> input(1000, 7);
+    std::vector<int> output(1000, 0);
+    array_view<int> input_av(int(input.size()), input);
+    array_view<int> output_av(int(output.size()), output);
+
+    start_tracing();
+    amp_stl_algorithms::copy(begin(input_av), end(input_av), begin(output_av));
+    stop_tracing();
+
+    const auto copies = find_events(get_trace_events(), trace_category::copy);
+    ASSERT_EQ(1, copies.size());
+    ASSERT_EQ(input.size() * sizeof(int), copies[0].bytes);
+}
+
+TEST_F(amp_trace_tests, sink_receives_events_instead_of_buffer)
+{
+    std::vector<int> input(1024, 1);
+    array_view<const int> input_av(int(input.size()), input);
+    std::vector<trace_event> received;
+    std::mutex received_mutex;
+
+    set_trace_sink([&](const trace_event& e) 
+    {
+        std::lock_guard<std::mutex> lock(received_mutex);
+        received.push_back(e);
+    });
+    start_tracing();
+    amp_algorithms::reduce(accelerator().default_view, input_av, amp_algorithms::plus<int>());
+    stop_tracing();
+
+    ASSERT_TRUE(get_trace_events().empty());
+    ASSERT_FALSE(find_events(received, trace_category::algorithm).empty());
+}
+
+TEST_F(amp_trace_tests, write_chrome_trace_escapes_names)
+{
+    trace_event e;
+    e.name = "say \"hi\"\\";
+    e.category = trace_category::kernel;
+    e.start_us = 1.5;
+    e.duration_us = 2.25;
+    e.extent.push_back(64);
+    e.extent.push_back(32);
+    e.tile.push_back(8);
+    e.tile.push_back(8);
+    e.bytes = 0;
+    e.thread_id = 3;
+    std::ostringstream stream;
+
+    write_chrome_trace(stream, std::vector<trace_event>(1, e));
+
+    const std::string json = stream.str();
+    ASSERT_NE(std::string::npos, json.find("{\"traceEvents\":["));
+    ASSERT_NE(std::string::npos, json.find("\"name\":\"say \\\"hi\\\"\\\\\""));
+    ASSERT_NE(std::string::npos, json.find("\"cat\":\"kernel\",\"ph\":\"X\",\"ts\":1.500,\"dur\":2.250"));
+    ASSERT_NE(std::string::npos, json.find("\"tid\":3"));
+    ASSERT_NE(std::string::npos, json.find("\"extent\":[64,32],\"tile\":[8,8]"));
+}
@@ -157,6 +157,17 @@ TEST_F(stl_algorithms_tests, count_counts_no_values)
     ASSERT_EQ(0, r);
 }
 
+TEST_F(stl_algorithms_tests, count_counts_values_without_host_dispatch)
+{
+    const int threshold = amp_algorithms::get_host_dispatch_threshold(amp_algorithms::host_dispatch_algorithm::count);
+    amp_algorithms::set_host_dispatch_threshold(amp_algorithms::host_dispatch_algorithm::count, 0);
+
+    auto r = amp_stl_algorithms::count(begin(input_av), end(input_av), 2);
+
+    amp_algorithms::set_host_dispatch_threshold(amp_algorithms::host_dispatch_algorithm::count, threshold);
+    ASSERT_EQ(5, r);
+}
+
 TEST_F(stl_algorithms_tests, count_if_counts_values)
 {
     auto r = amp_stl_algorithms::count_if(begin(input_av), end(input_av), [=](const int& v) restrict(amp) { return (v == 2); });
@@ -169,6 +180,18 @@ TEST_F(stl_algorithms_tests, count_if_counts_no_values)
     ASSERT_EQ(0, r);
 }
 
+TEST_F(stl_algorithms_tests, count_if_async_counts_values)
+{
+    concurrency::array<int> count(1);
+
+    amp_stl_algorithms::count_if_async(begin(input_av), end(input_av), [=](const int& v) restrict(amp) { return (v == 2); }, 
+        array_view<int>(count)).wait();
+
+    std::vector<int> r(1);
+    copy(count, begin(r));
+    ASSERT_EQ(5, r[0]);
+}
+
 //----------------------------------------------------------------------------
 // equal
 //----------------------------------------------------------------------------
@@ -368,6 +391,74 @@ TEST_F(stl_algorithms_tests, max_element_empty)
     ASSERT_EQ(begin(input_av), iter);
 }
 
+TEST_F(stl_algorithms_tests, min_max_element_position)
+{
+    // The input contains repeated values, the first occurrence should be returned.
+    std::vector<int> input(4096);
+    generate_data(input);
+    std::transform(cbegin(input), cend(input), begin(input), [](int v) { return v % 7; });
+    array_view<int> input_vw(static_cast<int>(input.size()), input);
+
+    auto expected_min = std::distance(begin(input), std::min_element(begin(input), end(input)));
+    auto expected_max = std::distance(begin(input), std::max_element(begin(input), end(input)));
+
+    ASSERT_EQ(expected_min, std::distance(begin(input_vw), amp_stl_algorithms::min_element(begin(input_vw), end(input_vw))));
+    ASSERT_EQ(expected_max, std::distance(begin(input_vw), amp_stl_algorithms::max_element(begin(input_vw), end(input_vw))));
+}
+
+TEST_F(stl_algorithms_tests, minmax_element)
+{
+    auto expected = std::minmax_element(begin(input), end(input));
+
+    auto r = amp_stl_algorithms::minmax_element(begin(input_av), end(input_av));
+
+    ASSERT_EQ(std::distance(begin(input), expected.first), std::distance(begin(input_av), r.first));
+    ASSERT_EQ(std::distance(begin(input), expected.second), std::distance(begin(input_av), r.second));
+}
+
+TEST_F(stl_algorithms_tests, minmax_element_pred)
+{
+    auto expected = std::minmax_element(begin(input), end(input), amp_algorithms::greater<int>());
+
+    auto r = amp_stl_algorithms::minmax_element(begin(input_av), end(input_av), amp_algorithms::greater<int>());
+
+    ASSERT_EQ(std::distance(begin(input), expected.first), std::distance(begin(input_av), r.first));
+    ASSERT_EQ(std::distance(begin(input), expected.second), std::distance(begin(input_av), r.second));
+}
+
+TEST_F(stl_algorithms_tests, minmax_element_empty)
+{
+    auto r = amp_stl_algorithms::minmax_element(begin(input_av), begin(input_av));
+
+    ASSERT_EQ(begin(input_av), r.first);
+    ASSERT_EQ(begin(input_av), r.second);
+}
+
+TEST_F(stl_algorithms_tests, minmax_element_position)
+{
+    // Many ties spread over several tiles.
+    std::vector<int> input(70001);
+    generate_data(input);
+    std::transform(cbegin(input), cend(input), begin(input), [](int v) { return v % 7; });
+    array_view<int> input_vw(static_cast<int>(input.size()), input);
+    auto expected = std::minmax_element(begin(input), end(input));
+
+    auto r = amp_stl_algorithms::minmax_element(begin(input_vw), end(input_vw));
+
+    ASSERT_EQ(std::distance(begin(input), expected.first), std::distance(begin(input_vw), r.first));
+    ASSERT_EQ(std::distance(begin(input), expected.second), std::distance(begin(input_vw), r.second));
+}
+
+TEST_F(stl_algorithms_tests, max_element_negative)
+{
+    std::array<int, 5> input = { -5, -3, -9, -3, -4 };
+    array_view<int> input_vw(static_cast<int>(input.size()), input);
+
+    auto iter = amp_stl_algorithms::max_element(begin(input_vw), end(input_vw));
+
+    ASSERT_EQ(1, std::distance(begin(input_vw), iter));
+}
+
 //----------------------------------------------------------------------------
 // reduce
 //----------------------------------------------------------------------------
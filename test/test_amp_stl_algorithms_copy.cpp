@@ -68,6 +68,20 @@ TEST_P(copy_if_tests, test)
 
 INSTANTIATE_TEST_CASE_P(stl_algorithms_tests, copy_if_tests, ::testing::ValuesIn(copy_data));
 
+TEST_F(stl_algorithms_tests, copy_if_async)
+{
+    auto expected_iter = std::copy_if(begin(input), end(input), begin(expected), greater_than<int>(5));
+    auto expected_size = static_cast<int>(std::distance(begin(expected), expected_iter));
+    concurrency::array<int> count(1);
+
+    amp_stl_algorithms::copy_if_async(begin(input_av), end(input_av), begin(output_av), greater_than<int>(5), array_view<int>(count)).wait();
+
+    std::vector<int> r(1);
+    copy(count, begin(r));
+    ASSERT_EQ(expected_size, r[0]);
+    ASSERT_TRUE(are_equal(expected, output_av, expected_size));
+}
+
 TEST_F(stl_algorithms_tests, copy_n)
 {
     int size = static_cast<int>(input.size() / 2);
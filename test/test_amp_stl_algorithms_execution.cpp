@@ -0,0 +1,130 @@
+/*----------------------------------------------------------------------------
+* Copyright (c) Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+* C++ AMP standard algorithm library.
+*
+* This file contains unit tests.
+*---------------------------------------------------------------------------*/
+
+
+#include "stdafx.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+#include <amp_stl_algorithms.h>
+#include "testtools.h"
+
+using namespace concurrency;
+using namespace amp_stl_algorithms;
+using namespace testtools;
+
+class stl_algorithms_tests : public stl_algorithms_testbase<13>, public ::testing::Test {};
+
+//----------------------------------------------------------------------------
+// execution policies
+//----------------------------------------------------------------------------
+
+TEST_F(stl_algorithms_tests, execution_policy_pins_target_view)
+{
+    const accelerator_view view = accelerator().create_view();
+    ASSERT_EQ(amp_algorithms::_details::auto_select_target(), _details::target_view());
+    {
+        const _details::target_view_scope scope(execution::device(view));
+        ASSERT_EQ(view, _details::target_view());
+        ASSERT_EQ(view, _details::scratch_view());
+        {
+            const _details::target_view_scope nested(execution::par);
+            ASSERT_EQ(amp_algorithms::_details::auto_select_target(), _details::target_view());
+            ASSERT_EQ(accelerator().default_view, _details::scratch_view());
+        }
+        ASSERT_EQ(view, _details::target_view());
+    }
+    ASSERT_EQ(amp_algorithms::_details::auto_select_target(), _details::target_view());
+}
+
+TEST_F(stl_algorithms_tests, execution_policy_pins_only_calling_thread)
+{
+    const accelerator_view view = accelerator().create_view();
+    const _details::target_view_scope scope(execution::device(view));
+    bool other_thread_pinned = true;
+
+    std::thread other([&]() { other_thread_pinned = (_details::pinned_view() != nullptr); });
+    other.join();
+
+    ASSERT_FALSE(other_thread_pinned);
+    ASSERT_EQ(view, _details::target_view());
+}
+
+TEST_F(stl_algorithms_tests, execution_policy_seq_runs_on_warp)
+{
+    ASSERT_EQ(accelerator(accelerator::direct3d_warp).device_path, execution::seq.accl_view().accelerator.device_path);
+    std::transform(cbegin(input), cend(input), begin(expected), [](int x) { return 2 * x; });
+
+    amp_stl_algorithms::transform(execution::seq, begin(input_av), end(input_av), begin(output_av), [](int x) restrict(amp) { return 2 * x; });
+
+    ASSERT_TRUE(are_equal(expected, output_av));
+}
+
+TEST_F(stl_algorithms_tests, execution_policy_device_allocates_temporaries_on_view)
+{
+    const accelerator_view view = accelerator().create_view();
+    std::copy(cbegin(input), cend(input), begin(expected));
+    auto expected_iter = std::remove_if(begin(expected), end(expected), [](int x) { return x == 2; });
+    auto expected_size = std::distance(begin(expected), expected_iter);
+
+    auto iter = amp_stl_algorithms::remove_if(execution::device(view), begin(input_av), end(input_av), [](int x) restrict(amp) { return x == 2; });
+
+    ASSERT_EQ(expected_size, std::distance(begin(input_av), iter));
+    ASSERT_TRUE(are_equal(expected, input_av, expected_size));
+    ASSERT_LT(0u, amp_algorithms::get_scratch_cached_bytes(view));
+}
+
+TEST_F(stl_algorithms_tests, execution_policy_par_matches_default)
+{
+    const int expected_sum = std::accumulate(cbegin(input), cend(input), 0);
+    const int expected_count = static_cast<int>(std::count(cbegin(input), cend(input), 2));
+
+    ASSERT_EQ(expected_sum, amp_stl_algorithms::reduce(execution::par, begin(input_av), end(input_av), 0));
+    ASSERT_EQ(expected_sum, amp_stl_algorithms::reduce(execution::par_unseq, begin(input_av), end(input_av), 0));
+    ASSERT_EQ(expected_count, amp_stl_algorithms::count(execution::par, begin(input_av), end(input_av), 2));
+}
+
+TEST_F(stl_algorithms_tests, execution_policy_swap_ranges)
+{
+    const accelerator_view view = accelerator().create_view();
+    const std::array<int, size> original_input = input;
+
+    auto last = amp_stl_algorithms::swap_ranges(execution::device(view), begin(input_av), end(input_av), begin(output_av));
+
+    ASSERT_EQ(size, std::distance(begin(output_av), last));
+    ASSERT_TRUE(are_equal(original_input, output_av));
+    ASSERT_TRUE(are_equal(expected, input_av));
+}
+
+TEST_F(stl_algorithms_tests, execution_policy_separate_views)
+{
+    const accelerator_view view1 = accelerator().create_view();
+    const accelerator_view view2 = accelerator().create_view();
+    std::array<int, size> output2;
+    array_view<int> output2_av(size, output2);
+
+    amp_stl_algorithms::fill(execution::device(view1), begin(output_av), end(output_av), 3);
+    amp_stl_algorithms::fill(execution::device(view2), begin(output2_av), end(output2_av), 5);
+    std::fill(begin(expected), end(expected), 3);
+    ASSERT_TRUE(are_equal(expected, output_av));
+    std::fill(begin(expected), end(expected), 5);
+    ASSERT_TRUE(are_equal(expected, output2_av));
+}
@@ -49,6 +49,17 @@ TEST_F(stl_algorithms_tests, find_finds_first_value)
     ASSERT_EQ(4, std::distance(begin(input_av), iter));
 }
 
+TEST_F(stl_algorithms_tests, find_finds_first_value_without_host_dispatch)
+{
+    const int threshold = amp_algorithms::get_host_dispatch_threshold(amp_algorithms::host_dispatch_algorithm::find);
+    amp_algorithms::set_host_dispatch_threshold(amp_algorithms::host_dispatch_algorithm::find, 0);
+
+    auto iter = amp_stl_algorithms::find(begin(input_av), end(input_av), 2);
+
+    amp_algorithms::set_host_dispatch_threshold(amp_algorithms::host_dispatch_algorithm::find, threshold);
+    ASSERT_EQ(4, std::distance(begin(input_av), iter));
+}
+
 TEST_F(stl_algorithms_tests, find_if_finds_no_values)
 {
     auto iter = amp_stl_algorithms::find_if(begin(input_av), end(input_av), [=](int v) restrict(amp) { return v == 17; });
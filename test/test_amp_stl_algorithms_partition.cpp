@@ -0,0 +1,154 @@
+/*----------------------------------------------------------------------------
+* Copyright (c) Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+* C++ AMP standard algorithm library.
+*
+* This file contains unit tests.
+*---------------------------------------------------------------------------*/
+
+#include "stdafx.h"
+#include <gtest/gtest.h>
+
+#include <amp_stl_algorithms.h>
+#include "testtools.h"
+
+using namespace concurrency;
+using namespace amp_stl_algorithms;
+using namespace testtools;
+
+//----------------------------------------------------------------------------
+// partition, stable_partition, partition_point, is_partitioned
+//----------------------------------------------------------------------------
+
+const std::array<int, 13> partition_data[] = {
+    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 1 },
+    { 3, 1, 0, 2, 3, 0, 0, 4, 0, 1, 0, 6, 7 }
+};
+
+class partition_tests : public stl_algorithms_testbase<13>, public ::testing::TestWithParam<std::array<int, 13>>
+{
+protected:
+    partition_tests()
+    {
+        std::copy(cbegin(GetParam()), cend(GetParam()), begin(input));
+    }
+};
+
+TEST_P(partition_tests, stable_partition)
+{
+    auto is_odd = [](int v) restrict(cpu, amp) { return (v % 2) == 1; };
+    std::copy(cbegin(input), cend(input), begin(expected));
+    auto expected_point = std::stable_partition(begin(expected), end(expected), is_odd);
+
+    auto result_point = amp_stl_algorithms::stable_partition(begin(input_av), end(input_av), is_odd);
+
+    ASSERT_EQ(std::distance(begin(expected), expected_point), std::distance(begin(input_av), result_point));
+    ASSERT_TRUE(are_equal(expected, input_av));
+}
+
+TEST_P(partition_tests, partition)
+{
+    auto is_odd = [](int v) restrict(cpu, amp) { return (v % 2) == 1; };
+    std::copy(cbegin(input), cend(input), begin(expected));
+    auto expected_point = std::partition(begin(expected), end(expected), is_odd);
+
+    auto result_point = amp_stl_algorithms::partition(begin(input_av), end(input_av), is_odd);
+
+    ASSERT_EQ(std::distance(begin(expected), expected_point), std::distance(begin(input_av), result_point));
+    input_av.synchronize();
+    ASSERT_TRUE(std::is_partitioned(cbegin(input), cend(input), is_odd));
+}
+
+TEST_P(partition_tests, is_partitioned)
+{
+    auto is_odd = [](int v) restrict(cpu, amp) { return (v % 2) == 1; };
+
+    ASSERT_EQ(std::is_partitioned(cbegin(input), cend(input), is_odd), 
+        amp_stl_algorithms::is_partitioned(begin(input_av), end(input_av), is_odd));
+
+    std::partition(begin(input), end(input), is_odd);
+    input_av.refresh();
+
+    ASSERT_TRUE(amp_stl_algorithms::is_partitioned(begin(input_av), end(input_av), is_odd));
+}
+
+TEST_P(partition_tests, partition_point)
+{
+    auto is_odd = [](int v) restrict(cpu, amp) { return (v % 2) == 1; };
+    std::partition(begin(input), end(input), is_odd);
+    input_av.refresh();
+    auto expected_point = std::partition_point(cbegin(input), cend(input), is_odd);
+
+    auto result_point = amp_stl_algorithms::partition_point(begin(input_av), end(input_av), is_odd);
+
+    ASSERT_EQ(std::distance(cbegin(input), expected_point), std::distance(begin(input_av), result_point));
+}
+
+INSTANTIATE_TEST_CASE_P(stl_algorithms_tests, partition_tests, ::testing::ValuesIn(partition_data));
+
+class partition_multi_tile_tests : public ::testing::TestWithParam<int> {};
+
+TEST_P(partition_multi_tile_tests, stable_partition_multi_tile)
+{
+    std::vector<int> input(GetParam());
+    generate_data(input);
+    array_view<int> input_av(static_cast<int>(input.size()), input);
+    std::vector<int> expected(input);
+    auto is_small = [](int v) restrict(cpu, amp) { return v < 10; };
+
+    auto expected_point = std::stable_partition(begin(expected), end(expected), is_small);
+
+    auto result_point = amp_stl_algorithms::stable_partition(begin(input_av), end(input_av), is_small);
+
+    ASSERT_EQ(std::distance(begin(expected), expected_point), std::distance(begin(input_av), result_point));
+    ASSERT_TRUE(are_equal(expected, input_av));
+}
+
+TEST_P(partition_multi_tile_tests, partition_point_multi_tile)
+{
+    // Try every partition point near the ends and across a range of positions in between.
+    std::vector<int> input(GetParam());
+    array_view<int> input_av(static_cast<int>(input.size()), input);
+    auto is_one = [](int v) restrict(cpu, amp) { return v == 1; };
+
+    for (int point = 0; point <= GetParam(); point += (point < 5 || point > GetParam() - 5) ? 1 : 997)
+    {
+        std::fill(begin(input), begin(input) + point, 1);
+        std::fill(begin(input) + point, end(input), 0);
+        input_av.refresh();
+
+        auto result_point = amp_stl_algorithms::partition_point(begin(input_av), end(input_av), is_one);
+
+        ASSERT_EQ(point, std::distance(begin(input_av), result_point));
+        ASSERT_TRUE(amp_stl_algorithms::is_partitioned(begin(input_av), end(input_av), is_one));
+    }
+}
+
+TEST_P(partition_multi_tile_tests, is_partitioned_multi_tile)
+{
+    std::vector<int> input(GetParam(), 1);
+    std::fill(begin(input) + GetParam() / 2, end(input), 0);
+    input.back() = 1;
+    array_view<int> input_av(static_cast<int>(input.size()), input);
+    auto is_one = [](int v) restrict(cpu, amp) { return v == 1; };
+
+    ASSERT_FALSE(amp_stl_algorithms::is_partitioned(begin(input_av), end(input_av), is_one));
+}
+
+INSTANTIATE_TEST_CASE_P(stl_algorithms_tests, partition_multi_tile_tests, ::testing::Values(255, 256, 257, 4096, 70001, 200000));
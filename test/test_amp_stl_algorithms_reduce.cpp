@@ -0,0 +1,147 @@
+/*----------------------------------------------------------------------------
+* Copyright (c) Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+* C++ AMP standard algorithm library.
+*
+* This file contains unit tests.
+*---------------------------------------------------------------------------*/
+
+#include "stdafx.h"
+#include <gtest/gtest.h>
+
+#include <amp_stl_algorithms.h>
+#include "testtools.h"
+
+using namespace concurrency;
+using namespace amp_stl_algorithms;
+using namespace testtools;
+
+//----------------------------------------------------------------------------
+// reduce_by_key
+//----------------------------------------------------------------------------
+
+template <typename BinaryOperation>
+int reduce_by_key_reference(const std::vector<int>& keys, const std::vector<int>& values, 
+    std::vector<int>& keys_dest, std::vector<int>& values_dest, BinaryOperation op)
+{
+    int count = 0;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        if ((i == 0) || (keys[i] != keys[i - 1]))
+        {
+            keys_dest[count] = keys[i];
+            values_dest[count++] = values[i];
+        }
+        else
+        {
+            values_dest[count - 1] = op(values_dest[count - 1], values[i]);
+        }
+    }
+    return count;
+}
+
+const std::array<int, 13> reduce_by_key_data[] = {
+    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+    { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 },
+    { 1, 1, 2, 2, 2, 3, 1, 1, 4, 4, 4, 4, 5 },
+    { 0, 1, 1, 0, 0, 0, 3, 3, 0, 1, 1, 1, 7 }
+};
+
+class reduce_by_key_tests : public ::testing::TestWithParam<std::array<int, 13>> {};
+
+TEST_P(reduce_by_key_tests, reduce_by_key)
+{
+    std::vector<int> keys(cbegin(GetParam()), cend(GetParam()));
+    std::vector<int> values(keys.size());
+    std::iota(begin(values), end(values), 1);
+    array_view<int> keys_av(static_cast<int>(keys.size()), keys);
+    array_view<int> values_av(static_cast<int>(values.size()), values);
+    std::vector<int> keys_output(keys.size(), -1);
+    std::vector<int> values_output(keys.size(), -1);
+    array_view<int> keys_output_av(static_cast<int>(keys_output.size()), keys_output);
+    array_view<int> values_output_av(static_cast<int>(values_output.size()), values_output);
+    std::vector<int> expected_keys(keys.size(), -1);
+    std::vector<int> expected_values(keys.size(), -1);
+    const int expected_count = reduce_by_key_reference(keys, values, expected_keys, expected_values, std::plus<int>());
+
+    const int count = amp_stl_algorithms::reduce_by_key(begin(keys_av), end(keys_av), begin(values_av), begin(keys_output_av), begin(values_output_av));
+
+    ASSERT_EQ(expected_count, count);
+    ASSERT_TRUE(are_equal(expected_keys, keys_output_av, count));
+    ASSERT_TRUE(are_equal(expected_values, values_output_av, count));
+}
+
+TEST_P(reduce_by_key_tests, reduce_by_key_with_max)
+{
+    std::vector<int> keys(cbegin(GetParam()), cend(GetParam()));
+    std::vector<int> values(keys.size());
+    generate_data(values);
+    array_view<int> keys_av(static_cast<int>(keys.size()), keys);
+    array_view<int> values_av(static_cast<int>(values.size()), values);
+    std::vector<int> keys_output(keys.size(), -1);
+    std::vector<int> values_output(keys.size(), -1);
+    array_view<int> keys_output_av(static_cast<int>(keys_output.size()), keys_output);
+    array_view<int> values_output_av(static_cast<int>(values_output.size()), values_output);
+    std::vector<int> expected_keys(keys.size(), -1);
+    std::vector<int> expected_values(keys.size(), -1);
+    const int expected_count = reduce_by_key_reference(keys, values, expected_keys, expected_values, 
+        [](int a, int b) { return std::max(a, b); });
+
+    const int count = amp_stl_algorithms::reduce_by_key(begin(keys_av), end(keys_av), begin(values_av), begin(keys_output_av), begin(values_output_av),
+        amp_algorithms::max<int>());
+
+    ASSERT_EQ(expected_count, count);
+    ASSERT_TRUE(are_equal(expected_keys, keys_output_av, count));
+    ASSERT_TRUE(are_equal(expected_values, values_output_av, count));
+}
+
+INSTANTIATE_TEST_CASE_P(stl_algorithms_tests, reduce_by_key_tests, ::testing::ValuesIn(reduce_by_key_data));
+
+class reduce_by_key_multi_tile_tests : public ::testing::TestWithParam<int> {};
+
+TEST_P(reduce_by_key_multi_tile_tests, reduce_by_key_multi_tile)
+{
+    // Runs of keys of varying length, some spanning several tiles.
+    std::vector<int> keys(GetParam());
+    int key = 0;
+    for (int i = 0, run = 1; i < GetParam(); ++key, run = (run * 7) % 1021 + 1)
+    {
+        for (int j = 0; (j < run) && (i < GetParam()); ++j)
+        {
+            keys[i++] = key;
+        }
+    }
+    std::vector<int> values(keys.size());
+    generate_data(values);
+    std::transform(cbegin(values), cend(values), begin(values), [](int v) { return v % 100; });
+    array_view<int> keys_av(static_cast<int>(keys.size()), keys);
+    array_view<int> values_av(static_cast<int>(values.size()), values);
+    std::vector<int> keys_output(keys.size(), -1);
+    std::vector<int> values_output(keys.size(), -1);
+    array_view<int> keys_output_av(static_cast<int>(keys_output.size()), keys_output);
+    array_view<int> values_output_av(static_cast<int>(values_output.size()), values_output);
+    std::vector<int> expected_keys(keys.size(), -1);
+    std::vector<int> expected_values(keys.size(), -1);
+    const int expected_count = reduce_by_key_reference(keys, values, expected_keys, expected_values, std::plus<int>());
+
+    const int count = amp_stl_algorithms::reduce_by_key(begin(keys_av), end(keys_av), begin(values_av), begin(keys_output_av), begin(values_output_av));
+
+    ASSERT_EQ(expected_count, count);
+    ASSERT_TRUE(are_equal(expected_keys, keys_output_av, count));
+    ASSERT_TRUE(are_equal(expected_values, values_output_av, count));
+}
+
+INSTANTIATE_TEST_CASE_P(stl_algorithms_tests, reduce_by_key_multi_tile_tests, ::testing::Values(255, 256, 257, 4096, 70001, 300000));
@@ -0,0 +1,197 @@
+/*----------------------------------------------------------------------------
+* Copyright (c) Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+* C++ AMP standard algorithm library.
+*
+* This file contains unit tests.
+*---------------------------------------------------------------------------*/
+
+#include "stdafx.h"
+#include <gtest/gtest.h>
+
+#include <amp_stl_algorithms.h>
+#include "testtools.h"
+
+using namespace concurrency;
+using namespace amp_stl_algorithms;
+using namespace testtools;
+
+//----------------------------------------------------------------------------
+// includes, set_difference, set_intersection, set_symmetric_difference, set_union
+//----------------------------------------------------------------------------
+
+typedef std::pair<std::vector<int>, std::vector<int>> set_data_type;
+
+const set_data_type set_data[] = {
+    set_data_type({ 1, 2, 3, 4, 5, 6, 7, 8 }, { 2, 4, 6, 8 }),
+    set_data_type({ 1, 1, 2, 3, 3, 3, 7 }, { 1, 2, 2, 3, 9 }),
+    set_data_type({ 1, 2, 3 }, { 4, 5, 6, 7 }),
+    set_data_type({ 4, 5, 6, 7 }, { 1, 2, 3 }),
+    set_data_type({ 5, 5, 5, 5, 5 }, { 5, 5 }),
+    set_data_type({ 2 }, { 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 6, 7, 8, 9, 9, 9, 9 }),
+    set_data_type({ 3 }, {}),
+    set_data_type({}, { 3 })
+};
+
+class set_tests : public ::testing::TestWithParam<set_data_type>
+{
+protected:
+    std::vector<int> input1;
+    std::vector<int> input2;
+    std::vector<int> output;
+    std::vector<int> expected;
+
+    set_tests() : input1(GetParam().first), input2(GetParam().second)
+    {
+        // Pad the inputs so that array_views can be created for empty ranges.
+        const size_t size = input1.size() + input2.size();
+        output.resize(size + 1, -1);
+        expected.resize(size + 1, -1);
+        input1.push_back(0);
+        input2.push_back(0);
+    }
+
+    array_view<int> input1_av() { return array_view<int>(static_cast<int>(input1.size()), input1); }
+    array_view<int> input2_av() { return array_view<int>(static_cast<int>(input2.size()), input2); }
+    array_view<int> output_av() { return array_view<int>(static_cast<int>(output.size()), output); }
+
+    int size1() const { return static_cast<int>(input1.size()) - 1; }
+    int size2() const { return static_cast<int>(input2.size()) - 1; }
+};
+
+TEST_P(set_tests, set_difference)
+{
+    auto in1 = input1_av();
+    auto in2 = input2_av();
+    auto out = output_av();
+    auto expected_last = std::set_difference(cbegin(input1), cbegin(input1) + size1(), cbegin(input2), cbegin(input2) + size2(), begin(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::set_difference(begin(in1), begin(in1) + size1(), begin(in2), begin(in2) + size2(), begin(out));
+
+    ASSERT_EQ(expected_size, std::distance(begin(out), result_last));
+    ASSERT_TRUE(are_equal(expected, out, expected_size));
+}
+
+TEST_P(set_tests, set_intersection)
+{
+    auto in1 = input1_av();
+    auto in2 = input2_av();
+    auto out = output_av();
+    auto expected_last = std::set_intersection(cbegin(input1), cbegin(input1) + size1(), cbegin(input2), cbegin(input2) + size2(), begin(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::set_intersection(begin(in1), begin(in1) + size1(), begin(in2), begin(in2) + size2(), begin(out));
+
+    ASSERT_EQ(expected_size, std::distance(begin(out), result_last));
+    ASSERT_TRUE(are_equal(expected, out, expected_size));
+}
+
+TEST_P(set_tests, set_symmetric_difference)
+{
+    auto in1 = input1_av();
+    auto in2 = input2_av();
+    auto out = output_av();
+    auto expected_last = std::set_symmetric_difference(cbegin(input1), cbegin(input1) + size1(), cbegin(input2), cbegin(input2) + size2(), begin(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::set_symmetric_difference(begin(in1), begin(in1) + size1(), begin(in2), begin(in2) + size2(), begin(out));
+
+    ASSERT_EQ(expected_size, std::distance(begin(out), result_last));
+    ASSERT_TRUE(are_equal(expected, out, expected_size));
+}
+
+TEST_P(set_tests, set_union)
+{
+    auto in1 = input1_av();
+    auto in2 = input2_av();
+    auto out = output_av();
+    auto expected_last = std::set_union(cbegin(input1), cbegin(input1) + size1(), cbegin(input2), cbegin(input2) + size2(), begin(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::set_union(begin(in1), begin(in1) + size1(), begin(in2), begin(in2) + size2(), begin(out));
+
+    ASSERT_EQ(expected_size, std::distance(begin(out), result_last));
+    ASSERT_TRUE(are_equal(expected, out, expected_size));
+}
+
+TEST_P(set_tests, includes)
+{
+    auto in1 = input1_av();
+    auto in2 = input2_av();
+    bool expected_1_2 = std::includes(cbegin(input1), cbegin(input1) + size1(), cbegin(input2), cbegin(input2) + size2());
+    bool expected_2_1 = std::includes(cbegin(input2), cbegin(input2) + size2(), cbegin(input1), cbegin(input1) + size1());
+
+    ASSERT_EQ(expected_1_2, amp_stl_algorithms::includes(begin(in1), begin(in1) + size1(), begin(in2), begin(in2) + size2()));
+    ASSERT_EQ(expected_2_1, amp_stl_algorithms::includes(begin(in2), begin(in2) + size2(), begin(in1), begin(in1) + size1()));
+}
+
+INSTANTIATE_TEST_CASE_P(stl_algorithms_tests, set_tests, ::testing::ValuesIn(set_data));
+
+class set_multi_tile_tests : public ::testing::TestWithParam<int> {};
+
+TEST_P(set_multi_tile_tests, set_intersection_multi_tile)
+{
+    // Sorted posting lists with many runs of duplicates that straddle thread boundaries.
+    std::vector<int> input1(GetParam());
+    std::vector<int> input2(GetParam() / 2 + 7);
+    generate_data(input1);
+    generate_data(input2);
+    std::transform(cbegin(input1), cend(input1), begin(input1), [](int v) { return std::abs(v) % 1000; });
+    std::transform(cbegin(input2), cend(input2), begin(input2), [](int v) { return std::abs(v) % 700; });
+    std::sort(begin(input1), end(input1));
+    std::sort(begin(input2), end(input2));
+    array_view<int> input1_av(static_cast<int>(input1.size()), input1);
+    array_view<int> input2_av(static_cast<int>(input2.size()), input2);
+    std::vector<int> expected(input1.size() + input2.size(), -1);
+    std::vector<int> output(input1.size() + input2.size(), -1);
+    array_view<int> output_av(static_cast<int>(output.size()), output);
+
+    auto expected_last = std::set_intersection(cbegin(input1), cend(input1), cbegin(input2), cend(input2), begin(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::set_intersection(begin(input1_av), end(input1_av), begin(input2_av), end(input2_av), begin(output_av));
+
+    ASSERT_EQ(expected_size, std::distance(begin(output_av), result_last));
+    ASSERT_TRUE(are_equal(expected, output_av, expected_size));
+}
+
+TEST_P(set_multi_tile_tests, set_union_multi_tile)
+{
+    std::vector<int> input1(GetParam());
+    std::vector<int> input2(GetParam() / 3 + 11);
+    generate_data(input1);
+    generate_data(input2);
+    std::transform(cbegin(input1), cend(input1), begin(input1), [](int v) { return std::abs(v) % 1000; });
+    std::transform(cbegin(input2), cend(input2), begin(input2), [](int v) { return std::abs(v) % 500; });
+    std::sort(begin(input1), end(input1));
+    std::sort(begin(input2), end(input2));
+    array_view<int> input1_av(static_cast<int>(input1.size()), input1);
+    array_view<int> input2_av(static_cast<int>(input2.size()), input2);
+    std::vector<int> expected(input1.size() + input2.size(), -1);
+    std::vector<int> output(input1.size() + input2.size(), -1);
+    array_view<int> output_av(static_cast<int>(output.size()), output);
+
+    auto expected_last = std::set_union(cbegin(input1), cend(input1), cbegin(input2), cend(input2), begin(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::set_union(begin(input1_av), end(input1_av), begin(input2_av), end(input2_av), begin(output_av));
+
+    ASSERT_EQ(expected_size, std::distance(begin(output_av), result_last));
+    ASSERT_TRUE(are_equal(expected, output_av, expected_size));
+}
+
+INSTANTIATE_TEST_CASE_P(stl_algorithms_tests, set_multi_tile_tests, ::testing::Values(1023, 4096, 70001));
@@ -0,0 +1,183 @@
+/*----------------------------------------------------------------------------
+* Copyright (c) Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not
+* use this file except in compliance with the License.  You may obtain a copy
+* of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+* MERCHANTABLITY OR NON-INFRINGEMENT.
+*
+* See the Apache Version 2.0 License for specific language governing
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+*
+* C++ AMP standard algorithm library.
+*
+* This file contains unit tests.
+*---------------------------------------------------------------------------*/
+
+#include "stdafx.h"
+#include <gtest/gtest.h>
+
+#include <amp_stl_algorithms.h>
+#include "testtools.h"
+
+using namespace concurrency;
+using namespace amp_stl_algorithms;
+using namespace testtools;
+
+//----------------------------------------------------------------------------
+// unique, unique_copy, unique_by_key, unique_by_key_copy
+//----------------------------------------------------------------------------
+
+const std::array<int, 13> unique_data[] = {
+    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+    { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 },
+    { 1, 1, 2, 2, 2, 3, 1, 1, 4, 4, 4, 4, 5 },
+    { 0, 1, 1, 0, 0, 0, 3, 3, 0, 1, 1, 1, 7 },
+    { 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6 }
+};
+
+class unique_tests : public stl_algorithms_testbase<13>, public ::testing::TestWithParam<std::array<int, 13>>
+{
+protected:
+    unique_tests()
+    {
+        std::copy(cbegin(GetParam()), cend(GetParam()), begin(input));
+    }
+};
+
+TEST_P(unique_tests, unique)
+{
+    std::copy(cbegin(input), cend(input), begin(expected));
+    auto expected_last = std::unique(begin(expected), end(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::unique(begin(input_av), end(input_av));
+
+    ASSERT_EQ(expected_size, std::distance(begin(input_av), result_last));
+    ASSERT_TRUE(are_equal(expected, input_av, expected_size));
+}
+
+TEST_P(unique_tests, unique_copy)
+{
+    auto expected_last = std::unique_copy(cbegin(input), cend(input), begin(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::unique_copy(begin(input_av), end(input_av), begin(output_av));
+
+    ASSERT_EQ(expected_size, std::distance(begin(output_av), result_last));
+    ASSERT_TRUE(are_equal(expected, output_av, expected_size));
+}
+
+TEST_P(unique_tests, unique_copy_with_predicate)
+{
+    // Treat values as equivalent if they have the same parity.
+    auto same_parity = [](int a, int b) restrict(cpu, amp) { return (a % 2) == (b % 2); };
+    auto expected_last = std::unique_copy(cbegin(input), cend(input), begin(expected), same_parity);
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::unique_copy(begin(input_av), end(input_av), begin(output_av), same_parity);
+
+    ASSERT_EQ(expected_size, std::distance(begin(output_av), result_last));
+    ASSERT_TRUE(are_equal(expected, output_av, expected_size));
+}
+
+TEST_P(unique_tests, unique_by_key_copy)
+{
+    std::array<int, 13> values;
+    std::iota(begin(values), end(values), 100);
+    array_view<int> values_av(static_cast<int>(values.size()), values);
+    std::vector<int> values_output(values.size(), -1);
+    array_view<int> values_output_av(static_cast<int>(values_output.size()), values_output);
+    std::vector<int> expected_values;
+    for (int i = 0; i < size; ++i)
+    {
+        if ((i == 0) || (input[i] != input[i - 1]))
+        {
+            expected_values.push_back(values[i]);
+        }
+    }
+    auto expected_last = std::unique_copy(cbegin(input), cend(input), begin(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::unique_by_key_copy(begin(input_av), end(input_av), begin(values_av), begin(output_av), begin(values_output_av));
+
+    ASSERT_EQ(expected_size, std::distance(begin(output_av), result_last.first));
+    ASSERT_EQ(expected_size, std::distance(begin(values_output_av), result_last.second));
+    ASSERT_TRUE(are_equal(expected, output_av, expected_size));
+    ASSERT_TRUE(are_equal(expected_values, values_output_av, expected_size));
+}
+
+TEST_P(unique_tests, unique_by_key)
+{
+    std::array<int, 13> values;
+    std::iota(begin(values), end(values), 100);
+    array_view<int> values_av(static_cast<int>(values.size()), values);
+    std::vector<int> expected_values;
+    for (int i = 0; i < size; ++i)
+    {
+        if ((i == 0) || (input[i] != input[i - 1]))
+        {
+            expected_values.push_back(values[i]);
+        }
+    }
+    std::copy(cbegin(input), cend(input), begin(expected));
+    auto expected_last = std::unique(begin(expected), end(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::unique_by_key(begin(input_av), end(input_av), begin(values_av));
+
+    ASSERT_EQ(expected_size, std::distance(begin(input_av), result_last.first));
+    ASSERT_EQ(expected_size, std::distance(begin(values_av), result_last.second));
+    ASSERT_TRUE(are_equal(expected, input_av, expected_size));
+    ASSERT_TRUE(are_equal(expected_values, values_av, expected_size));
+}
+
+INSTANTIATE_TEST_CASE_P(stl_algorithms_tests, unique_tests, ::testing::ValuesIn(unique_data));
+
+class unique_multi_tile_tests : public ::testing::TestWithParam<int> {};
+
+TEST_P(unique_multi_tile_tests, unique_copy_multi_tile)
+{
+    // Long runs of duplicates that straddle tile boundaries.
+    std::vector<int> input(GetParam());
+    for (int i = 0; i < GetParam(); ++i)
+    {
+        input[i] = (i / 37) % 5;
+    }
+    array_view<int> input_av(static_cast<int>(input.size()), input);
+    std::vector<int> expected(input.size(), -1);
+    std::vector<int> output(input.size(), -1);
+    array_view<int> output_av(static_cast<int>(output.size()), output);
+
+    auto expected_last = std::unique_copy(cbegin(input), cend(input), begin(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::unique_copy(begin(input_av), end(input_av), begin(output_av));
+
+    ASSERT_EQ(expected_size, std::distance(begin(output_av), result_last));
+    ASSERT_TRUE(are_equal(expected, output_av, expected_size));
+}
+
+TEST_P(unique_multi_tile_tests, unique_multi_tile)
+{
+    std::vector<int> input(GetParam());
+    generate_data(input);
+    std::transform(cbegin(input), cend(input), begin(input), [](int v) { return std::abs(v) % 3; });
+    array_view<int> input_av(static_cast<int>(input.size()), input);
+    std::vector<int> expected(input);
+
+    auto expected_last = std::unique(begin(expected), end(expected));
+    auto expected_size = std::distance(begin(expected), expected_last);
+
+    auto result_last = amp_stl_algorithms::unique(begin(input_av), end(input_av));
+
+    ASSERT_EQ(expected_size, std::distance(begin(input_av), result_last));
+    ASSERT_TRUE(are_equal(expected, input_av, expected_size));
+}
+
+INSTANTIATE_TEST_CASE_P(stl_algorithms_tests, unique_multi_tile_tests, ::testing::Values(511, 512, 513, 4096, 70001));
@@ -208,3 +208,125 @@ TEST(stl_iterator_tests, random_access_iterator_in_amp)
         ASSERT_EQ(1, v2[1 + i]);
     }
 }
+
+TEST(stl_iterator_tests, counting_iterator)
+{
+    counting_iterator<int> iter(3);
+
+    ASSERT_EQ(3, *iter);
+    ASSERT_EQ(7, iter[4]);
+    ASSERT_EQ(5, (iter + 5) - iter);
+    ASSERT_TRUE(iter < iter + 1);
+    ASSERT_TRUE(iter + 2 > iter);
+    ASSERT_TRUE(iter == counting_iterator<int>(3));
+    ASSERT_EQ(5, *(2 + iter));
+    ++iter;
+    iter += 3;
+    ASSERT_EQ(7, *iter);
+}
+
+TEST(stl_iterator_tests, transform_iterator_in_amp)
+{
+    const int size = 1024;
+    std::vector<int> v(size);
+    array_view<int> av(size, v);
+    auto iter = make_transform_iterator(counting_iterator<int>(0), [](int x) restrict(cpu, amp) { return 3 * x; });
+
+    parallel_for_each(av.extent, [=](concurrency::index<1> idx) restrict(amp)
+    {
+        av[idx] = iter[idx[0]];
+    });
+    av.synchronize();
+
+    for (int i = 0; i < size; ++i)
+    {
+        ASSERT_EQ(3 * i, v[i]);
+    }
+}
+
+TEST(stl_iterator_tests, reduce_transform_counting_iterator)
+{
+    const int size = 10000;
+    auto residues = make_transform_iterator(counting_iterator<int>(0), [](int x) restrict(cpu, amp) { return x % 7; });
+    int expected = 0;
+    for (int i = 0; i < size; ++i)
+    {
+        expected += i % 7;
+    }
+
+    ASSERT_EQ(expected, amp_stl_algorithms::reduce(residues, residues + size, 0, amp_algorithms::plus<int>()));
+}
+
+TEST(stl_iterator_tests, count_if_and_find_counting_iterator)
+{
+    counting_iterator<int> first(0);
+
+    ASSERT_EQ(334, amp_stl_algorithms::count_if(first, first + 1000, [](int x) restrict(amp) { return (x % 3) == 0; }));
+    ASSERT_EQ(1, amp_stl_algorithms::count(first, first + 1000, 100));
+    ASSERT_EQ(first + 42, amp_stl_algorithms::find(first, first + 1000, 42));
+}
+
+TEST(stl_iterator_tests, transform_zip_iterator)
+{
+    const int size = 513;
+    std::vector<int> input1(size), input2(size), output(size);
+    testtools::generate_data(input1);
+    std::iota(begin(input2), end(input2), 0);
+    array_view<const int> input1_av(size, input1);
+    array_view<const int> input2_av(size, input2);
+    array_view<int> output_av(size, output);
+    auto zip = make_zip_iterator(begin(input1_av), begin(input2_av));
+
+    amp_stl_algorithms::transform(zip, zip + size, begin(output_av), [](const amp_stl_algorithms::pair<int, int>& p) restrict(amp) { return p.first - p.second; });
+
+    output_av.synchronize();
+    for (int i = 0; i < size; ++i)
+    {
+        ASSERT_EQ(input1[i] - input2[i], output[i]);
+    }
+}
+
+TEST(stl_iterator_tests, permutation_iterator_gather_and_scatter)
+{
+    const int size = 300;
+    std::vector<int> elements(size), indices(size), gathered(size, -1), scattered(size, -1);
+    testtools::generate_data(elements);
+    for (int i = 0; i < size; ++i)
+    {
+        indices[i] = (i * 7) % size;
+    }
+    array_view<const int> elements_av(size, elements);
+    array_view<const int> indices_av(size, indices);
+    array_view<int> gathered_av(size, gathered);
+    array_view<int> scattered_av(size, scattered);
+
+    auto gather = make_permutation_iterator(begin(elements_av), begin(indices_av));
+    amp_stl_algorithms::copy(gather, gather + size, begin(gathered_av));
+    auto scatter = make_permutation_iterator(begin(scattered_av), begin(indices_av));
+    amp_stl_algorithms::transform(begin(elements_av), end(elements_av), scatter, [](int x) restrict(amp) { return x; });
+
+    gathered_av.synchronize();
+    scattered_av.synchronize();
+    for (int i = 0; i < size; ++i)
+    {
+        ASSERT_EQ(elements[indices[i]], gathered[i]);
+        ASSERT_EQ(elements[i], scattered[indices[i]]);
+    }
+}
+
+TEST(stl_iterator_tests, transform_constant_iterator)
+{
+    const int size = 100;
+    std::vector<int> input(size), output(size);
+    testtools::generate_data(input);
+    array_view<const int> input_av(size, input);
+    array_view<int> output_av(size, output);
+
+    amp_stl_algorithms::transform(begin(input_av), end(input_av), constant_iterator<int>(5), begin(output_av), amp_algorithms::plus<int>());
+
+    output_av.synchronize();
+    for (int i = 0; i < size; ++i)
+    {
+        ASSERT_EQ(input[i] + 5, output[i]);
+    }
+}